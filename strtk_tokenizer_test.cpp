@@ -26,7 +26,9 @@
 
 
 #include <cstddef>
+#include <cstdio>
 #include <cstdlib>
+#include <iomanip>
 #include <iostream>
 #include <iterator>
 #include <algorithm>
@@ -391,7 +393,8 @@ bool test_tokenizer_options()
 
       typedef strtk::std_string::tokenizer<strtk::multiple_char_delimiter_predicate>::type tokenizer_type;
 
-      tokenizer_type tokenizer(s,strtk::multiple_char_delimiter_predicate("abcijkxyz"),tokenize_options);
+      strtk::multiple_char_delimiter_predicate predicate("abcijkxyz");
+      tokenizer_type tokenizer(s,predicate,tokenize_options);
       tokenizer_type::iterator itr = tokenizer.begin();
       tokenizer_type::iterator end = tokenizer.end();
 
@@ -428,7 +431,8 @@ bool test_tokenizer_options()
 
       typedef strtk::std_string::tokenizer<strtk::multiple_char_delimiter_predicate>::type tokenizer_type;
 
-      tokenizer_type tokenizer(s,strtk::multiple_char_delimiter_predicate("abcijkxyz"),tokenize_options);
+      strtk::multiple_char_delimiter_predicate predicate("abcijkxyz");
+      tokenizer_type tokenizer(s,predicate,tokenize_options);
       tokenizer_type::iterator itr = tokenizer.begin();
       tokenizer_type::iterator end = tokenizer.end();
 
@@ -582,221 +586,2030 @@ bool test_empty_filter_itr()
    }
 }
 
-struct data_block
+template <typename Predicate>
+bool test_contiguous_split_instance(const Predicate& p,
+                                    const std::string& s,
+                                    const strtk::split_options::type& split_option)
 {
-   std::string    d1;
-   char           d2;
-   int            d3;
-   unsigned int   d4;
-   double         d5;
-   float          d6;
-   short          d7;
-   unsigned short d8;
-   bool           d9;
-   unsigned char  d10;
+   typedef std::pair<const char*,const char*> ptr_range_t;
+   typedef std::pair<std::string::const_iterator,std::string::const_iterator> itr_range_t;
 
-   void clear(const std::size_t& i)
+   std::vector<ptr_range_t> ptr_list;
+   std::vector<itr_range_t> itr_list;
+
+   strtk::split(p,s.data(),s.data() + s.size(),std::back_inserter(ptr_list),split_option);
+   strtk::split(p,s.begin(),s.end(),std::back_inserter(itr_list),split_option);
+
+   if (ptr_list.size() != itr_list.size())
+      return false;
+
+   for (std::size_t i = 0; i < ptr_list.size(); ++i)
    {
-      if (i >=  1) d1  = "";
-      if (i >=  2) d2  = 0x00;
-      if (i >=  3) d3  = 0;
-      if (i >=  4) d4  = 0;
-      if (i >=  5) d5  = 0;
-      if (i >=  6) d6  = 0;
-      if (i >=  7) d7  = 7;
-      if (i >=  8) d8  = 0;
-      if (i >=  9) d9  = false;
-      if (i >= 10) d10 = 0x00;
+      if (
+          (std::distance(s.data(),ptr_list[i].first ) != std::distance(s.begin(),itr_list[i].first )) ||
+          (std::distance(s.data(),ptr_list[i].second) != std::distance(s.begin(),itr_list[i].second))
+         )
+         return false;
    }
 
-   bool operator==(const data_block& db)
+   for (std::size_t n = 1; n <= itr_list.size(); ++n)
    {
-      return d1 == db.d1 &&
-             d2 == db.d2 &&
-             d3 == db.d3 &&
-             d4 == db.d4 &&
-    !not_equal(d5,db.d5) &&
-    !not_equal(d6,db.d6) &&
-             d7 == db.d7 &&
-             d8 == db.d8 &&
-             d9 == db.d9 &&
-             d10 == db.d10;
+      ptr_list.clear();
+      itr_list.clear();
+
+      strtk::split_n(p,s.data(),s.data() + s.size(),n,std::back_inserter(ptr_list),split_option);
+      strtk::split_n(p,s.begin(),s.end(),n,std::back_inserter(itr_list),split_option);
+
+      if (ptr_list.size() != itr_list.size())
+         return false;
+
+      for (std::size_t i = 0; i < ptr_list.size(); ++i)
+      {
+         if (
+             (std::distance(s.data(),ptr_list[i].first ) != std::distance(s.begin(),itr_list[i].first )) ||
+             (std::distance(s.data(),ptr_list[i].second) != std::distance(s.begin(),itr_list[i].second))
+            )
+            return false;
+      }
    }
 
-   bool operator!=(const data_block& db)
+   typedef strtk::tokenizer<const char*,Predicate> ptr_tokenizer_t;
+   typedef strtk::tokenizer<std::string::const_iterator,Predicate> itr_tokenizer_t;
+
+   ptr_tokenizer_t ptr_tokenizer(s.data(),s.data() + s.size(),p,split_option);
+   itr_tokenizer_t itr_tokenizer(s.begin(),s.end(),p,split_option);
+
+   typename ptr_tokenizer_t::iterator ptr_itr = ptr_tokenizer.begin();
+   typename itr_tokenizer_t::iterator itr_itr = itr_tokenizer.begin();
+
+   while ((ptr_tokenizer.end() != ptr_itr) && (itr_tokenizer.end() != itr_itr))
    {
-      return !this->operator ==(db);
+      if (
+          (std::distance(s.data(),(*ptr_itr).first ) != std::distance(s.begin(),(*itr_itr).first )) ||
+          (std::distance(s.data(),(*ptr_itr).second) != std::distance(s.begin(),(*itr_itr).second))
+         )
+         return false;
+      ++ptr_itr;
+      ++itr_itr;
    }
-};
 
-inline void std_double_to_string(const double& d, std::string& s)
-{
-   char buffer[128];
-   std::size_t sz = sprintf(buffer,"%20.19e",d);
-   buffer[sz] = 0;
-   s.assign(buffer);
+   return (ptr_tokenizer.end() == ptr_itr) && (itr_tokenizer.end() == itr_itr);
 }
 
-inline bool strtk_isnan(const double& v)
+template <typename Predicate>
+bool test_contiguous_split_predicate(const Predicate& p, const std::string& alphabet, const std::string& name)
 {
-   volatile double d = v;
-   return d != d;
-}
+   const strtk::split_options::type split_option_list[] =
+                                    {
+                                      strtk::split_options::default_mode,
+                                      strtk::split_options::compress_delimiters,
+                                      strtk::split_options::include_1st_delimiter,
+                                      strtk::split_options::include_all_delimiters,
+                                      strtk::split_options::include_1st_delimiter + strtk::split_options::compress_delimiters
+                                    };
+
+   const std::size_t split_option_count = sizeof(split_option_list) / sizeof(strtk::split_options::type);
+
+   unsigned int seed = 0x1234567;
+   std::string s;
 
-bool test_fast_convert()
-{
+   for (std::size_t length = 0; length < 150; ++length)
    {
-      int v = 0;
-      for (int i = -100000000; i < +100000000; ++i)
+      for (std::size_t round = 0; round < 8; ++round)
       {
-         if (!strtk::fast::signed_numeric_convert(strtk::type_to_string(i),v,true))
+         s.resize(length);
+
+         for (std::size_t i = 0; i < length; ++i)
          {
-            std::cout << "test_fast_convert() - Failed Fast convert 1  i = " << i << std::endl;
+            seed = (seed * 1103515245) + 12345;
+            s[i] = alphabet[((seed >> 16) & 0x7FFF) % alphabet.size()];
          }
 
-         if (i != v)
+         for (std::size_t i = 0; i < split_option_count; ++i)
          {
-            std::cout << "test_fast_convert() - Failed Fast convert 2 "
-                      << " i = " << i
-                      << " v = " << v << std::endl;
-            return false;
+            if (!test_contiguous_split_instance(p,s,split_option_list[i]))
+            {
+               std::cout << "test_contiguous_split() - " << name << " failed for mode: " << split_option_list[i]
+                         << " input: [" << s << "]" << std::endl;
+               return false;
+            }
          }
       }
    }
 
+   return true;
+}
+
+bool test_contiguous_split()
+{
+   if (!test_contiguous_split_predicate(strtk::multiple_char_delimiter_predicate("|"),"ab|","mcdp(1)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::multiple_char_delimiter_predicate("|,\t"),"abcd|,\t","mcdp(3)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::multiple_char_delimiter_predicate("|,\t"),"abcdefghijklmnopqrstuvwxyz|","mcdp(sparse)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::multiple_char_delimiter_predicate(" ,;:|!@#$%^&*()_+-=\t"),"ab ,;:|!@#$%^&*()_+-=\t","mcdp(20)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::single_delimiter_predicate<char>('|'),"ab|","sdp(dense)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::single_delimiter_predicate<char>('\n'),"abcdefghijklmnopqrstuvwxyz\n","sdp(sparse)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::static_delimiter_predicate<'|'>(),"ab|","stdp(1)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::static_delimiter_predicate<'|',',','\t'>(),"abcd|,\t","stdp(3)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::static_delimiter_predicate<'a','a','|',',','b','b','b','\t'>(),"abcd|,\t","stdp(8)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::string_delimiter_predicate("|"),"ab|","strdp(1)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::string_delimiter_predicate("||"),"ab|","strdp(2)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::string_delimiter_predicate("\r\n"),"abcdefgh\r\n","strdp(crlf)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::string_delimiter_predicate("<|>"),"ab<|>","strdp(3)"))
+      return false;
+   else if (!test_contiguous_split_predicate(strtk::string_delimiter_predicate("aab"),"ab","strdp(overlap)"))
+      return false;
+
    {
-      unsigned int v = 0;
-      for (unsigned int i = 0; i < 1000000000; ++i)
+      const std::string s = "a||b||||c||";
+      const std::string expected_token[] = { "a", "b", "", "c", "" };
+      const std::size_t expected_token_size = sizeof(expected_token) / sizeof(std::string);
+
+      std::vector<std::string> token_list;
+
+      strtk::split(strtk::string_delimiter_predicate("||"),s,strtk::range_to_type_back_inserter(token_list));
+
+      if (token_list.size() != expected_token_size)
       {
-         if (!strtk::fast::numeric_convert(strtk::type_to_string(i),v,true))
-         {
-            std::cout << "test_fast_convert() - Failed Fast convert 1  i = " << i << std::endl;
-         }
+         std::cout << "test_contiguous_split() - string delimiter token count mismatch" << std::endl;
+         return false;
+      }
 
-         if (i != v)
+      for (std::size_t i = 0; i < expected_token_size; ++i)
+      {
+         if (expected_token[i] != token_list[i])
          {
-            std::cout << "test_fast_convert() - Failed Fast convert 2  "
-                      << "i = " << i
-                      << "v = " << v << std::endl;
+            std::cout << "test_contiguous_split() - string delimiter failed match @ " << i << std::endl;
             return false;
          }
       }
    }
 
+   return true;
+}
+
+template <typename Predicate>
+bool test_split_parallel_predicate(const Predicate& p, const std::string& alphabet, const std::string& name)
+{
+   typedef std::pair<const char*,const char*> range_t;
+
+   const strtk::split_options::type split_option_list[] =
+                                    {
+                                      strtk::split_options::default_mode,
+                                      strtk::split_options::compress_delimiters,
+                                      strtk::split_options::include_1st_delimiter
+                                    };
+
+   const std::size_t split_option_count = sizeof(split_option_list) / sizeof(strtk::split_options::type);
+
+   unsigned int seed = 0x7654321;
+   std::string s(100000 + alphabet.size(),' ');
+
+   for (std::size_t i = 0; i < s.size(); ++i)
    {
-      std::string s[] = {
-                            "0000000000000000",   "1111111111111111",   "2222222222222222",   "3333333333333333",   "4444444444444444",
-                            "5555555555555555",   "6666666666666666",   "1234567890123456",   "9876543210987654",   "1919191919191919",
-                           "00000000000000000",  "11111111111111111",  "22222222222222222",  "33333333333333333",  "44444444444444444",
-                           "55555555555555555",  "66666666666666666",  "12345678901234567",  "98765432109876543",  "19191919191919191",
-                          "000000000000000000", "111111111111111111", "222222222222222222", "333333333333333333", "444444444444444444",
-                          "555555555555555555", "666666666666666666", "123456789012345677", "987654321098765432", "191919191919191919"
-                        };
+      seed = (seed * 1103515245) + 12345;
+      s[i] = alphabet[((seed >> 16) & 0x7FFF) % alphabet.size()];
+   }
 
-      unsigned long long v[] = {
-                              0000000000000000LL,   1111111111111111LL,   2222222222222222LL,   3333333333333333LL,   4444444444444444LL,
-                              5555555555555555LL,   6666666666666666LL,   1234567890123456LL,   9876543210987654LL,   1919191919191919LL,
-                             00000000000000000LL,  11111111111111111LL,  22222222222222222LL,  33333333333333333LL,  44444444444444444LL,
-                             55555555555555555LL,  66666666666666666LL,  12345678901234567LL,  98765432109876543LL,  19191919191919191LL,
-                            000000000000000000LL, 111111111111111111LL, 222222222222222222LL, 333333333333333333LL, 444444444444444444LL,
-                            555555555555555555LL, 666666666666666666LL, 123456789012345677LL, 987654321098765432LL, 191919191919191919LL
-                        };
+   for (std::size_t i = 0; i < split_option_count; ++i)
+   {
+      std::vector<range_t> expected_list;
+      strtk::split(p,s.data(),s.data() + s.size(),std::back_inserter(expected_list),split_option_list[i]);
 
-      for (std::size_t i = 0 ; i < (sizeof(s) / sizeof(std::string)); ++i)
+      for (std::size_t thread_count = 1; thread_count <= 5; ++thread_count)
       {
-         unsigned long long t = 0;
-         strtk::fast::numeric_convert(s[i],t);
-         if (t != v[i])
-         {
-            strtk::fast::numeric_convert(s[i],t);
+         std::vector<range_t> token_list;
 
-            std::cout << "test_fast_convert() - Failed Fast convert Special Test unsigned long long "
-                      << " index = " << i
-                      << " t = " << t
-                      << " v[index] = " << v[i] << std::endl;
+         const std::size_t token_count = strtk::split_parallel(p,s,token_list,split_option_list[i],thread_count);
+
+         if ((token_count != expected_list.size()) || (token_list != expected_list))
+         {
+            std::cout << "test_split_parallel() - " << name << " failed, "
+                      << "option: " << split_option_list[i] << " "
+                      << "threads: " << thread_count << std::endl;
             return false;
          }
       }
    }
 
    return true;
+}
+
+bool test_split_parallel()
+{
+   if (!test_split_parallel_predicate(strtk::single_delimiter_predicate<char>(','),"abc,","sdp"))
+      return false;
+   else if (!test_split_parallel_predicate(strtk::single_delimiter_predicate<char>(','),"a,,,,,,,,,,,,,,,,,,,,,,,,","sdp(runs)"))
+      return false;
+   else if (!test_split_parallel_predicate(strtk::multiple_char_delimiter_predicate(",|"),"abcdefghij,|","mcdp"))
+      return false;
+   else if (!test_split_parallel_predicate(strtk::static_delimiter_predicate<'\n'>(),"abcdefghijklmnopqrstuvwxyz\n","stdp"))
+      return false;
+   else if (!test_split_parallel_predicate(strtk::string_delimiter_predicate("\r\n"),"ab\r\n","strdp"))
+      return false;
+
+   {
+      const std::string s = ",,,";
+      std::vector<std::vector<std::pair<const char*,const char*> > > chunk_token_list;
+
+      if (4 != strtk::split_parallel(strtk::single_delimiter_predicate<char>(','),s.data(),s.data() + s.size(),chunk_token_list))
+      {
+         std::cout << "test_split_parallel() - empty token count mismatch" << std::endl;
+         return false;
+      }
+   }
 
+   return true;
 }
 
-bool test_double_convert()
+bool test_token_grid_equal(const strtk::token_grid& g0, const strtk::token_grid& g1, const std::string& name)
 {
+   if (g0.row_count() != g1.row_count())
    {
-      static const std::string fract10_str[] =
-                   {
-                      "0.0",
-                      "1.0E+001", "1.0E+002", "1.0E+003", "1.0E+004", "1.0E+005", "1.0E+006", "1.0E+007", "1.0E+008", "1.0E+009", "1.0E+010",
-                      "1.0E+011", "1.0E+012", "1.0E+013", "1.0E+014", "1.0E+015", "1.0E+016", "1.0E+017", "1.0E+018", "1.0E+019", "1.0E+020",
-                      "1.0E+021", "1.0E+022", "1.0E+023", "1.0E+024", "1.0E+025", "1.0E+026", "1.0E+027", "1.0E+028", "1.0E+029", "1.0E+030",
-                      "1.0E+031", "1.0E+032", "1.0E+033", "1.0E+034", "1.0E+035", "1.0E+036", "1.0E+037", "1.0E+038", "1.0E+039", "1.0E+040",
-                      "1.0E+041", "1.0E+042", "1.0E+043", "1.0E+044", "1.0E+045", "1.0E+046", "1.0E+047", "1.0E+048", "1.0E+049", "1.0E+050",
-                      "1.0E+051", "1.0E+052", "1.0E+053", "1.0E+054", "1.0E+055", "1.0E+056", "1.0E+057", "1.0E+058", "1.0E+059", "1.0E+060",
-                      "1.0E+061", "1.0E+062", "1.0E+063", "1.0E+064", "1.0E+065", "1.0E+066", "1.0E+067", "1.0E+068", "1.0E+069", "1.0E+070",
-                      "1.0E+071", "1.0E+072", "1.0E+073", "1.0E+074", "1.0E+075", "1.0E+076", "1.0E+077", "1.0E+078", "1.0E+079", "1.0E+080",
-                      "1.0E+081", "1.0E+082", "1.0E+083", "1.0E+084", "1.0E+085", "1.0E+086", "1.0E+087", "1.0E+088", "1.0E+089", "1.0E+090",
-                      "1.0E+091", "1.0E+092", "1.0E+093", "1.0E+094", "1.0E+095", "1.0E+096", "1.0E+097", "1.0E+098", "1.0E+099", "1.0E+100",
-                      "1.0E+101", "1.0E+102", "1.0E+103", "1.0E+104", "1.0E+105", "1.0E+106", "1.0E+107", "1.0E+108", "1.0E+109", "1.0E+110",
-                      "1.0E+111", "1.0E+112", "1.0E+113", "1.0E+114", "1.0E+115", "1.0E+116", "1.0E+117", "1.0E+118", "1.0E+119", "1.0E+120",
-                      "1.0E+121", "1.0E+122", "1.0E+123", "1.0E+124", "1.0E+125", "1.0E+126", "1.0E+127", "1.0E+128", "1.0E+129", "1.0E+130",
-                      "1.0E+131", "1.0E+132", "1.0E+133", "1.0E+134", "1.0E+135", "1.0E+136", "1.0E+137", "1.0E+138", "1.0E+139", "1.0E+140",
-                      "1.0E+141", "1.0E+142", "1.0E+143", "1.0E+144", "1.0E+145", "1.0E+146", "1.0E+147", "1.0E+148", "1.0E+149", "1.0E+150",
-                      "1.0E+151", "1.0E+152", "1.0E+153", "1.0E+154", "1.0E+155", "1.0E+156", "1.0E+157", "1.0E+158", "1.0E+159", "1.0E+160",
-                      "1.0E+161", "1.0E+162", "1.0E+163", "1.0E+164", "1.0E+165", "1.0E+166", "1.0E+167", "1.0E+168", "1.0E+169", "1.0E+170",
-                      "1.0E+171", "1.0E+172", "1.0E+173", "1.0E+174", "1.0E+175", "1.0E+176", "1.0E+177", "1.0E+178", "1.0E+179", "1.0E+180",
-                      "1.0E+181", "1.0E+182", "1.0E+183", "1.0E+184", "1.0E+185", "1.0E+186", "1.0E+187", "1.0E+188", "1.0E+189", "1.0E+190",
-                      "1.0E+191", "1.0E+192", "1.0E+193", "1.0E+194", "1.0E+195", "1.0E+196", "1.0E+197", "1.0E+198", "1.0E+199", "1.0E+200",
-                      "1.0E+201", "1.0E+202", "1.0E+203", "1.0E+204", "1.0E+205", "1.0E+206", "1.0E+207", "1.0E+208", "1.0E+209", "1.0E+210",
-                      "1.0E+211", "1.0E+212", "1.0E+213", "1.0E+214", "1.0E+215", "1.0E+216", "1.0E+217", "1.0E+218", "1.0E+219", "1.0E+220",
-                      "1.0E+221", "1.0E+222", "1.0E+223", "1.0E+224", "1.0E+225", "1.0E+226", "1.0E+227", "1.0E+228", "1.0E+229", "1.0E+230",
-                      "1.0E+231", "1.0E+232", "1.0E+233", "1.0E+234", "1.0E+235", "1.0E+236", "1.0E+237", "1.0E+238", "1.0E+239", "1.0E+240",
-                      "1.0E+241", "1.0E+242", "1.0E+243", "1.0E+244", "1.0E+245", "1.0E+246", "1.0E+247", "1.0E+248", "1.0E+249", "1.0E+250",
-                      "1.0E+251", "1.0E+252", "1.0E+253", "1.0E+254", "1.0E+255", "1.0E+256", "1.0E+257", "1.0E+258", "1.0E+259", "1.0E+260",
-                      "1.0E+261", "1.0E+262", "1.0E+263", "1.0E+264", "1.0E+265", "1.0E+266", "1.0E+267", "1.0E+268", "1.0E+269", "1.0E+270",
-                      "1.0E+271", "1.0E+272", "1.0E+273", "1.0E+274", "1.0E+275", "1.0E+276", "1.0E+277", "1.0E+278", "1.0E+279", "1.0E+280",
-                      "1.0E+281", "1.0E+282", "1.0E+283", "1.0E+284", "1.0E+285", "1.0E+286", "1.0E+287", "1.0E+288", "1.0E+289", "1.0E+290",
-                      "1.0E+291", "1.0E+292", "1.0E+293", "1.0E+294", "1.0E+295", "1.0E+296", "1.0E+297", "1.0E+298", "1.0E+299", "1.0E+300",
-                      "1.0E+301", "1.0E+302", "1.0E+303", "1.0E+304", "1.0E+305", "1.0E+306", "1.0E+307", "1.0E+308"
-                   };
+      std::cout << "test_token_grid_equal() - " << name << " row count mismatch" << std::endl;
+      return false;
+   }
+   else if (
+            (g0.min_column_count() != g1.min_column_count()) ||
+            (g0.max_column_count() != g1.max_column_count())
+           )
+   {
+      std::cout << "test_token_grid_equal() - " << name << " column count mismatch" << std::endl;
+      return false;
+   }
 
-      const std::size_t dbl_size = sizeof(fract10_str) / sizeof(std::string);
+   for (std::size_t r = 0; r < g0.row_count(); ++r)
+   {
+      const strtk::token_grid::row_type row0 = g0.row(static_cast<unsigned int>(r));
+      const strtk::token_grid::row_type row1 = g1.row(static_cast<unsigned int>(r));
 
-      bool result = true;
+      if (row0.size() != row1.size())
+      {
+         std::cout << "test_token_grid_equal() - " << name << " row size mismatch @ " << r << std::endl;
+         return false;
+      }
 
-      for (std::size_t i = 1; i < dbl_size; ++i)
+      for (std::size_t c = 0; c < row0.size(); ++c)
       {
-         double d = std::numeric_limits<double>::quiet_NaN();
+         const strtk::token_grid::range_t token0 = row0.token(c);
+         const strtk::token_grid::range_t token1 = row1.token(c);
 
-         if (!strtk::string_to_type_converter(fract10_str[i],d))
+         if (
+             ((token0.second - token0.first) != (token1.second - token1.first)) ||
+             !std::equal(token0.first,token0.second,token1.first)
+            )
          {
-            std::cout << "test_double_convert() exp10 test convert failure [" << i << "] "
-                      << "str: ["<< fract10_str[i] << "]" << std::endl;
-            result = false;
+            std::cout << "test_token_grid_equal() - " << name << " token mismatch @ " << r << "," << c << std::endl;
+            return false;
          }
+      }
+   }
 
-         if (not_equal(d,std::pow(10.0,1.0 * i)))
+   return true;
+}
+
+bool test_compact_token_index()
+{
+   {
+      typedef std::pair<const char*,const char*> range_t;
+
+      const std::string s = "abc,,de,f,,,ghij,";
+      const strtk::single_delimiter_predicate<char> predicate(',');
+
+      std::vector<range_t> range_list;
+      std::deque<strtk::compact_range> compact_list;
+
+      strtk::split(predicate,s.data(),s.data() + s.size(),std::back_inserter(range_list));
+      strtk::split(predicate,s.data(),s.data() + s.size(),strtk::compact_range_back_inserter(s.data(),compact_list));
+
+      if (range_list.size() != compact_list.size())
+      {
+         std::cout << "test_compact_token_index() - split token count mismatch" << std::endl;
+         return false;
+      }
+
+      for (std::size_t i = 0; i < range_list.size(); ++i)
+      {
+         if (range_list[i] != strtk::expand_range(s.data(),compact_list[i]))
          {
-            std::cout << "test_double_convert() exp10 test value check failure [" << i << "] "
-                      << "str: ["  << fract10_str[i] << "]  "
-                      << "value: " << d << " "
-                      << "cmpv : " << std::pow(10.0,1.0 * i) << std::endl;
-            result= false;
+            std::cout << "test_compact_token_index() - split token mismatch @ " << i << std::endl;
+            return false;
          }
       }
-
-      if (!result)
-         return false;
    }
 
+   const std::string data = "1,2,3,4\n"
+                            "5,,6\n"
+                            "\"a\",\"b,c\",d,e,f\n"
+                            "\n"
+                            "7,8,9,10\n"
+                            ",11,12,\n";
+
+   for (std::size_t i = 0; i < 2; ++i)
    {
-      static const std::string double_str[] =
-                  {
-                       "7379973.6624700",          "+2187496.9290991",            "384281.3720002",
-                     "06603499.49182570",            "-80173.0014819",             "+00693.000285",
-                            "-0.6366299",             "+0.2335175000",               "-00.6366299",
+      strtk::token_grid::options options;
+      options.column_delimiters = ",";
+      options.column_split_option = strtk::split_options::default_mode;
+      options.support_dquotes = (1 == i);
+      options.trim_dquotes = (1 == i);
+
+      strtk::token_grid grid(data,data.size(),options);
+      strtk::token_grid compact_grid(data,data.size(),options.set_compact_token_index(true));
+
+      if (!test_token_grid_equal(grid,compact_grid,"load"))
+         return false;
+
+      grid.remove_row(1);
+      compact_grid.remove_row(1);
+
+      if (!test_token_grid_equal(grid,compact_grid,"remove_row"))
+         return false;
+
+      grid.remove_empty_tokens();
+      compact_grid.remove_empty_tokens();
+
+      if (!test_token_grid_equal(grid,compact_grid,"remove_empty_tokens"))
+         return false;
+
+      std::string row0;
+      std::string row1;
+
+      grid.join_row(1,"|",row0);
+      compact_grid.join_row(1,"|",row1);
+
+      if (row0 != row1)
+      {
+         std::cout << "test_compact_token_index() - join_row mismatch" << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_stream_tokenizer_instance(strtk::stream_tokenizer<>& tokenizer,
+                                    const std::vector<std::string>& expected_line_list,
+                                    const std::string& name)
+{
+   typedef strtk::stream_tokenizer<>::range_t range_t;
+
+   std::vector<range_t> token_list;
+   std::size_t line_index = 0;
+
+   while (tokenizer.next_line(strtk::single_delimiter_predicate<char>(','),token_list))
+   {
+      if (line_index >= expected_line_list.size())
+      {
+         std::cout << "test_stream_tokenizer() - " << name << " too many lines" << std::endl;
+         return false;
+      }
+
+      std::vector<range_t> expected_token_list;
+      const std::string& line = expected_line_list[line_index];
+
+      strtk::split(strtk::single_delimiter_predicate<char>(','),
+                   line.data(),line.data() + line.size(),
+                   std::back_inserter(expected_token_list));
+
+      if (token_list.size() != expected_token_list.size())
+      {
+         std::cout << "test_stream_tokenizer() - " << name << " token count mismatch @ " << line_index << std::endl;
+         return false;
+      }
+
+      for (std::size_t i = 0; i < token_list.size(); ++i)
+      {
+         if (
+             std::string(token_list[i].first,token_list[i].second) !=
+             std::string(expected_token_list[i].first,expected_token_list[i].second)
+            )
+         {
+            std::cout << "test_stream_tokenizer() - " << name << " token mismatch @ " << line_index << "," << i << std::endl;
+            return false;
+         }
+      }
+
+      ++line_index;
+   }
+
+   if (line_index != expected_line_list.size())
+   {
+      std::cout << "test_stream_tokenizer() - " << name << " line count mismatch" << std::endl;
+      return false;
+   }
+
+   return true;
+}
+
+bool test_stream_tokenizer()
+{
+   std::string data;
+   std::vector<std::string> line_list;
+   unsigned int seed = 0x13579BD;
+
+   for (std::size_t i = 0; i < 300; ++i)
+   {
+      seed = (seed * 1103515245) + 12345;
+      std::size_t length = ((seed >> 16) & 0x7FFF) % ((0 == (i % 50)) ? 500 : 40);
+      std::string line;
+
+      for (std::size_t j = 0; j < length; ++j)
+      {
+         seed = (seed * 1103515245) + 12345;
+         line += "abc,"[((seed >> 16) & 0x7FFF) % 4];
+      }
+
+      line_list.push_back(line);
+      data += line;
+
+      if (i != 299)
+         data += '\n';
+   }
+
+   const std::size_t block_size_list[] = { 1, 7, 64, 4096 };
+   const std::size_t block_size_count = sizeof(block_size_list) / sizeof(std::size_t);
+
+   for (std::size_t i = 0; i < block_size_count; ++i)
+   {
+      std::istringstream stream(data);
+      strtk::stream_tokenizer<> tokenizer(stream,block_size_list[i]);
+
+      if (!test_stream_tokenizer_instance(tokenizer,line_list,"istream"))
+         return false;
+   }
+
+   #ifdef strtk_enable_posix
+   {
+      int fd[2];
+
+      if (0 != pipe(fd))
+      {
+         std::cout << "test_stream_tokenizer() - failed to create pipe" << std::endl;
+         return false;
+      }
+
+      if (data.size() != static_cast<std::size_t>(write(fd[1],data.data(),data.size())))
+      {
+         std::cout << "test_stream_tokenizer() - failed to write pipe" << std::endl;
+         close(fd[0]);
+         close(fd[1]);
+         return false;
+      }
+
+      close(fd[1]);
+
+      strtk::stream_tokenizer<> tokenizer(fd[0],100);
+      const bool result = test_stream_tokenizer_instance(tokenizer,line_list,"fd");
+
+      close(fd[0]);
+
+      if (!result || tokenizer.bad())
+         return false;
+   }
+
+   {
+      // Reading a directory fails with EISDIR, which must not look like EOF.
+      const int fd = open(".",O_RDONLY);
+
+      if (fd >= 0)
+      {
+         strtk::stream_tokenizer<> tokenizer(fd,100);
+         strtk::stream_tokenizer<>::range_t line;
+
+         const bool read = tokenizer.next_line(line);
+
+         close(fd);
+
+         if (read || !tokenizer.bad())
+         {
+            std::cout << "test_stream_tokenizer() - read error not reported" << std::endl;
+            return false;
+         }
+      }
+   }
+   #endif
+
+   return true;
+}
+
+bool test_dsv_quote_index()
+{
+   typedef std::pair<const unsigned char*,const unsigned char*> range_t;
+
+   const std::string alphabet = "ab,\"\n";
+   unsigned int seed = 0x2468ACE;
+
+   for (std::size_t length = 0; length < 300; ++length)
+   {
+      std::string s(length,' ');
+
+      for (std::size_t i = 0; i < length; ++i)
+      {
+         seed = (seed * 1103515245) + 12345;
+         s[i] = alphabet[((seed >> 16) & 0x7FFF) % alphabet.size()];
+      }
+
+      const unsigned char* begin = reinterpret_cast<const unsigned char*>(s.data());
+      const unsigned char* end   = begin + s.size();
+
+      std::vector<std::size_t> expected_row;
+      std::vector<std::size_t> expected_column;
+      bool in_quotes = false;
+
+      for (std::size_t i = 0; i < length; ++i)
+      {
+         if ('"' == s[i])
+            in_quotes = !in_quotes;
+         else if (!in_quotes && ('\n' == s[i]))
+            expected_row.push_back(i);
+         else if (!in_quotes && (',' == s[i]))
+            expected_column.push_back(i);
+      }
+
+      strtk::dsv_quote_index quote_index(begin,end,"\n",",");
+
+      const strtk::dsv_quote_index::predicate row_predicate = quote_index.row_predicate();
+      const strtk::dsv_quote_index::predicate column_predicate = quote_index.column_predicate();
+
+      std::vector<range_t> row_list;
+      std::vector<range_t> column_list;
+
+      strtk::split(row_predicate,begin,end,std::back_inserter(row_list));
+      strtk::split(column_predicate,begin,end,std::back_inserter(column_list));
+
+      const std::size_t expected_row_count    = (0 == length) ? 0 : expected_row.size()    + 1;
+      const std::size_t expected_column_count = (0 == length) ? 0 : expected_column.size() + 1;
+
+      if ((row_list.size() != expected_row_count) || (column_list.size() != expected_column_count))
+      {
+         std::cout << "test_dsv_quote_index() - token count mismatch, length: " << length << std::endl;
+         return false;
+      }
+
+      for (std::size_t i = 0; i < expected_row.size(); ++i)
+      {
+         if (row_list[i].second != (begin + expected_row[i]))
+         {
+            std::cout << "test_dsv_quote_index() - row delimiter mismatch, length: " << length << std::endl;
+            return false;
+         }
+      }
+
+      for (std::size_t i = 0; i < expected_column.size(); ++i)
+      {
+         if (column_list[i].second != (begin + expected_column[i]))
+         {
+            std::cout << "test_dsv_quote_index() - column delimiter mismatch, length: " << length << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      const std::string data = "1,\"a,b\",\"say \"\"hi\"\"\"\n"
+                               "2,\"multi\nline\",x\n"
+                               "\n"
+                               "3,,\"\"\n";
+
+      strtk::token_grid::options options;
+      options.column_delimiters = ",";
+      options.column_split_option = strtk::split_options::default_mode;
+      options.support_dquotes = true;
+      options.trim_dquotes = true;
+
+      strtk::token_grid grid(data,data.size(),options);
+
+      const std::string expected[3][3] = {
+                                            { "1", "a,b"        , "say \"\"hi\"\"" },
+                                            { "2", "multi\nline", "x"              },
+                                            { "3", ""           , ""               }
+                                         };
+
+      if (3 != grid.row_count())
+      {
+         std::cout << "test_dsv_quote_index() - grid row count mismatch: " << grid.row_count() << std::endl;
+         return false;
+      }
+
+      for (std::size_t r = 0; r < 3; ++r)
+      {
+         const strtk::token_grid::row_type row = grid.row(static_cast<unsigned int>(r));
+
+         if (3 != row.size())
+         {
+            std::cout << "test_dsv_quote_index() - grid column count mismatch @ " << r << std::endl;
+            return false;
+         }
+
+         for (std::size_t c = 0; c < 3; ++c)
+         {
+            if (expected[r][c] != row.get<std::string>(c))
+            {
+               std::cout << "test_dsv_quote_index() - grid token mismatch @ " << r << "," << c << std::endl;
+               return false;
+            }
+         }
+      }
+   }
+
+   {
+      const strtk::dsv_quote_index empty_index;
+      const unsigned char* p = reinterpret_cast<const unsigned char*>("a,b");
+
+      if ((p + 3) != empty_index.column_predicate().find(p,p + 3))
+      {
+         std::cout << "test_dsv_quote_index() - empty index found a delimiter" << std::endl;
+         return false;
+      }
+   }
+
+   {
+      // Lookups in arbitrary order across several 4KB segments.
+      std::string s(20000,' ');
+
+      for (std::size_t i = 0; i < s.size(); ++i)
+      {
+         seed = (seed * 1103515245) + 12345;
+         s[i] = "ab,\"\nxyz"[((seed >> 16) & 0x7FFF) % 8];
+      }
+
+      const unsigned char* begin = reinterpret_cast<const unsigned char*>(s.data());
+      const unsigned char* end   = begin + s.size();
+
+      std::vector<std::size_t> next_column(s.size() + 1,s.size());
+      std::vector<bool> in_quotes(s.size(),false);
+      bool quoted = false;
+
+      for (std::size_t i = 0; i < s.size(); ++i)
+      {
+         if ('"' == s[i]) quoted = !quoted;
+         in_quotes[i] = quoted;
+      }
+
+      for (std::size_t i = s.size(); i > 0; --i)
+      {
+         const bool column = (',' == s[i - 1]) && !in_quotes[i - 1];
+         next_column[i - 1] = column ? (i - 1) : next_column[i];
+      }
+
+      const strtk::dsv_quote_index quote_index(begin,end,"\n",",");
+      const strtk::dsv_quote_index::predicate column_predicate = quote_index.column_predicate();
+
+      for (std::size_t i = 0; i < 2000; ++i)
+      {
+         seed = (seed * 1103515245) + 12345;
+         const std::size_t position = ((seed >> 8) & 0xFFFFFF) % s.size();
+
+         if (column_predicate.find(begin + position,end) != (begin + next_column[position]))
+         {
+            std::cout << "test_dsv_quote_index() - random lookup mismatch @ " << position << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+bool test_token_batch()
+{
+   typedef strtk::token_batch<>::range_t range_t;
+
+   const strtk::single_delimiter_predicate<char> row_predicate('\n');
+   const strtk::multiple_char_delimiter_predicate column_predicate(",|");
+
+   strtk::token_batch<> batch;
+   unsigned int seed = 0x1A2B3C4;
+
+   for (std::size_t round = 0; round < 50; ++round)
+   {
+      std::string data((round * 37) % 1000,' ');
+
+      for (std::size_t i = 0; i < data.size(); ++i)
+      {
+         seed = (seed * 1103515245) + 12345;
+         data[i] = "abcd,|\n"[((seed >> 16) & 0x7FFF) % 7];
+      }
+
+      const strtk::split_options::type split_option = (round & 1) ?
+                                                      strtk::split_options::compress_delimiters :
+                                                      strtk::split_options::default_mode;
+
+      const std::size_t row_count = batch.split(row_predicate,column_predicate,
+                                                data.data(),data.data() + data.size(),
+                                                split_option);
+
+      std::vector<range_t> row_list;
+      strtk::split(row_predicate,
+                   data.data(),data.data() + data.size(),
+                   std::back_inserter(row_list),
+                   strtk::split_options::compress_delimiters);
+
+      std::size_t row = 0;
+      std::size_t token_count = 0;
+
+      for (std::size_t i = 0; i < row_list.size(); ++i)
+      {
+         if (row_list[i].first == row_list[i].second)
+            continue;
+
+         std::vector<range_t> token_list;
+         strtk::split(column_predicate,row_list[i].first,row_list[i].second,std::back_inserter(token_list),split_option);
+
+         if ((row >= row_count) || (batch.row_size(row) != token_list.size()))
+         {
+            std::cout << "test_token_batch() - row size mismatch, round: " << round << " row: " << row << std::endl;
+            return false;
+         }
+
+         for (std::size_t j = 0; j < token_list.size(); ++j)
+         {
+            if (batch.token(row,j) != token_list[j])
+            {
+               std::cout << "test_token_batch() - token mismatch, round: " << round << " row: " << row << std::endl;
+               return false;
+            }
+         }
+
+         token_count += token_list.size();
+         ++row;
+      }
+
+      if ((row != row_count) || (token_count != batch.token_count()))
+      {
+         std::cout << "test_token_batch() - count mismatch, round: " << round << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_field_index()
+{
+   typedef strtk::field_index<>::range_t range_t;
+
+   const std::string data_list[] =
+                     {
+                       "",
+                       ",",
+                       "abc",
+                       "0,1,2,3,4,5,6,7,8,9",
+                       ",1,,3,,5,",
+                       "a,bb,ccc,dddd,eeeee,ffffff,ggggggg,hhhhhhhh,iiiiiiiii,jjjjjjjjjj,kkkkkkkkkkk,llllllllllll"
+                     };
+
+   const std::size_t data_list_size = sizeof(data_list) / sizeof(std::string);
+   const strtk::single_delimiter_predicate<char> predicate(',');
+
+   strtk::field_index<> index;
+
+   for (std::size_t i = 0; i < data_list_size; ++i)
+   {
+      const std::string& data = data_list[i];
+
+      std::vector<range_t> token_list;
+      strtk::split(predicate,data.data(),data.data() + data.size(),std::back_inserter(token_list));
+
+      for (std::size_t last_column = 0; last_column <= token_list.size() + 1; ++last_column)
+      {
+         index.assign(predicate,data.data(),data.data() + data.size(),last_column);
+
+         const std::size_t expected_size = std::min(token_list.size(),last_column + 1);
+
+         if (index.size() != expected_size)
+         {
+            std::cout << "test_field_index() - size mismatch @ " << i << " last column: " << last_column << std::endl;
+            return false;
+         }
+
+         for (std::size_t j = 0; j < index.size(); ++j)
+         {
+            if (index[j] != token_list[j])
+            {
+               std::cout << "test_field_index() - field mismatch @ " << i << "," << j << std::endl;
+               return false;
+            }
+         }
+      }
+   }
+
+   {
+      const std::string data = "x||12||3.5||abc||-7";
+      strtk::field_index<> sindex(strtk::string_delimiter_predicate("||"),data.data(),data.data() + data.size(),4);
+
+      int i0 = 0;
+      double d0 = 0.0;
+      std::string s0;
+      int i1 = 0;
+
+      if (!sindex.parse_with_index(4,1,3,2,i0,i1,s0,d0))
+      {
+         std::cout << "test_field_index() - parse_with_index failed" << std::endl;
+         return false;
+      }
+      else if ((-7 != i0) || (12 != i1) || ("abc" != s0) || (3.5 != d0))
+      {
+         std::cout << "test_field_index() - parse_with_index value mismatch" << std::endl;
+         return false;
+      }
+      else if (sindex.get(5,i0))
+      {
+         std::cout << "test_field_index() - out of range get succeeded" << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_token_grid_memory_map()
+{
+   const std::string file_name = "strtk_token_grid_memory_map.tmp";
+   const std::string data = "1,2,3\n4,5,6\n7,8,9,10\n";
+
+   {
+      std::ofstream stream(file_name.c_str(),std::ios::binary);
+      stream << data;
+   }
+
+   strtk::token_grid::options options;
+   options.column_delimiters = ",";
+
+   strtk::token_grid buffer_grid(data,data.size(),options);
+   strtk::token_grid file_grid(file_name,options);
+   strtk::token_grid mapped_grid(file_name,options.set_memory_map(true));
+
+   bool result = test_token_grid_equal(buffer_grid,file_grid,"file") &&
+                 test_token_grid_equal(buffer_grid,mapped_grid,"memory map");
+
+   if (result)
+   {
+      mapped_grid.clear();
+
+      if (0 != mapped_grid.row_count())
+      {
+         std::cout << "test_token_grid_memory_map() - clear failed" << std::endl;
+         result = false;
+      }
+      else if (!mapped_grid.load(file_name,options))
+      {
+         std::cout << "test_token_grid_memory_map() - reload failed" << std::endl;
+         result = false;
+      }
+      else
+         result = test_token_grid_equal(buffer_grid,mapped_grid,"memory map reload");
+   }
+
+   std::remove(file_name.c_str());
+
+   return result;
+}
+
+bool test_token_grid_thread_count()
+{
+   std::string data;
+   unsigned int seed = 0x5A5A5A5;
+
+   for (std::size_t i = 0; i < 150000; ++i)
+   {
+      seed = (seed * 1103515245) + 12345;
+      data += "abc,,\"x,\n\"\n\r1234"[((seed >> 16) & 0x7FFF) % 17];
+   }
+
+   for (std::size_t i = 0; i < 4; ++i)
+   {
+      strtk::token_grid::options options;
+      options.column_delimiters = ",";
+      options.support_dquotes = (0 != (i & 1));
+      options.trim_dquotes = options.support_dquotes;
+      options.compact_token_index = (0 != (i & 2));
+
+      strtk::token_grid grid(data,data.size(),options);
+
+      for (std::size_t thread_count = 2; thread_count <= 5; ++thread_count)
+      {
+         strtk::token_grid parallel_grid(data,data.size(),options.set_thread_count(thread_count));
+
+         if (!test_token_grid_equal(grid,parallel_grid,"thread count"))
+            return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_token_grid_static_delimiters()
+{
+   const std::string data = "a,b|c\nd|e,f,g\n\n1,2,3|4\n,|,x\n";
+
+   strtk::token_grid::options options;
+   options.column_delimiters = ",|";
+
+   strtk::token_grid grid(data,data.size(),options);
+   strtk::token_grid static_grid(data,data.size(),options.set_column_delimiters(strtk::static_delimiter_predicate<',','|'>()));
+
+   if (!test_token_grid_equal(grid,static_grid,"static delimiters"))
+      return false;
+
+   strtk::token_grid parallel_grid(data,data.size(),options.set_thread_count(3));
+
+   if (!test_token_grid_equal(grid,parallel_grid,"static delimiters thread count"))
+      return false;
+
+   // Assigning the field after the static setter replaces the static set.
+   options.column_delimiters = "|";
+   strtk::token_grid assigned_grid(data,data.size(),options);
+
+   strtk::token_grid::options pipe_options;
+   pipe_options.column_delimiters = "|";
+   strtk::token_grid pipe_grid(data,data.size(),pipe_options);
+
+   return test_token_grid_equal(pipe_grid,assigned_grid,"static delimiters reassigned");
+}
+
+bool test_token_grid_materialize()
+{
+   std::string data;
+   unsigned int seed = 0x3C3C3C3;
+
+   for (std::size_t i = 0; i < 20000; ++i)
+   {
+      seed = (seed * 1103515245) + 12345;
+      const unsigned int r = (seed >> 16) & 0x7FFF;
+
+      data += strtk::type_to_string(i) + "," + strtk::type_to_string(r % 100) + ".5,";
+      data += ((r % 7) ? "xyz"[r % 3] : '?');
+
+      if (r % 11)
+         data += "," + strtk::type_to_string(r);
+
+      data += '\n';
+   }
+
+   strtk::token_grid::options options;
+   options.column_delimiters = ",";
+
+   strtk::token_grid grid(data,data.size(),options);
+
+   for (std::size_t thread_count = 1; thread_count <= 4; thread_count += 3)
+   {
+      std::vector<std::size_t> column_index_list;
+      column_index_list.push_back(1);
+      column_index_list.push_back(3);
+
+      std::vector<strtk::token_grid::typed_column<double> > column_list;
+      strtk::token_grid::typed_column<long long> id_column;
+      strtk::token_grid::dictionary_column dictionary_column;
+
+      if (
+          !grid.materialize_columns(grid.all_rows(),column_index_list,column_list,thread_count) ||
+          !grid.materialize_column(0,id_column,thread_count) ||
+          !grid.materialize_column(2,dictionary_column,thread_count)
+         )
+      {
+         std::cout << "test_token_grid_materialize() - materialize failed" << std::endl;
+         return false;
+      }
+
+      std::size_t invalid_count = 0;
+
+      for (std::size_t i = 0; i < grid.row_count(); ++i)
+      {
+         const strtk::token_grid::row_type row = grid.row(static_cast<unsigned int>(i));
+
+         if (
+             !id_column.is_valid(i) ||
+             (row.get<long long>(0) != id_column.values[i]) ||
+             !column_list[0].is_valid(i) ||
+             (row.get<double>(1) != column_list[0].values[i]) ||
+             (row.get<std::string>(2) != dictionary_column[i])
+            )
+         {
+            std::cout << "test_token_grid_materialize() - value mismatch @ " << i << std::endl;
+            return false;
+         }
+
+         if (row.size() > 3)
+         {
+            if (!column_list[1].is_valid(i) || (row.get<double>(3) != column_list[1].values[i]))
+            {
+               std::cout << "test_token_grid_materialize() - value mismatch @ " << i << std::endl;
+               return false;
+            }
+         }
+         else if (column_list[1].is_valid(i))
+         {
+            std::cout << "test_token_grid_materialize() - validity mismatch @ " << i << std::endl;
+            return false;
+         }
+         else
+            ++invalid_count;
+      }
+
+      if ((invalid_count != column_list[1].invalid_count) || (4 != dictionary_column.dictionary.size()))
+      {
+         std::cout << "test_token_grid_materialize() - invalid/dictionary count mismatch" << std::endl;
+         return false;
+      }
+   }
+
+   std::string flag_data;
+
+   for (std::size_t i = 0; i < 20000; ++i)
+   {
+      flag_data += strtk::type_to_string(i) + ((0 == (i % 3)) ? ",1\n" : ",0\n");
+   }
+
+   strtk::token_grid flag_grid(flag_data,flag_data.size(),options);
+
+   // Partitions of a bool column are written concurrently.
+   strtk::token_grid::typed_column<bool> flag_column;
+
+   if (!flag_grid.materialize_column(1,flag_column,4) || (0 != flag_column.invalid_count))
+   {
+      std::cout << "test_token_grid_materialize() - bool materialize failed" << std::endl;
+      return false;
+   }
+
+   for (std::size_t i = 0; i < flag_grid.row_count(); ++i)
+   {
+      if ((0 == (i % 3)) != (0 != flag_column.values[i]))
+      {
+         std::cout << "test_token_grid_materialize() - bool value mismatch @ " << i << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_token_grid_index_file()
+{
+   const std::string file_name  = "strtk_token_grid_index_file.tmp";
+   const std::string index_name = "strtk_token_grid_index_file.idx";
+   const std::string data = "a,b,c\n\"d,e\",f\n\ng,h,i,j\n";
+
+   {
+      std::ofstream stream(file_name.c_str(),std::ios::binary);
+      stream << data;
+   }
+
+   std::remove(index_name.c_str());
+
+   strtk::token_grid::options options;
+   options.column_delimiters = ",";
+   options.support_dquotes = true;
+
+   strtk::token_grid buffer_grid(data,data.size(),options);
+
+   options.set_index_file(index_name);
+
+   strtk::token_grid built_grid(file_name,options);
+
+   bool result = true;
+
+   if (!std::ifstream(index_name.c_str()))
+   {
+      std::cout << "test_token_grid_index_file() - index file not written" << std::endl;
+      result = false;
+   }
+   else
+   {
+      strtk::token_grid indexed_grid(file_name,options);
+
+      result = test_token_grid_equal(buffer_grid,built_grid,"index build") &&
+               test_token_grid_equal(buffer_grid,indexed_grid,"index reuse") &&
+               (buffer_grid.min_column_count() == indexed_grid.min_column_count()) &&
+               (buffer_grid.max_column_count() == indexed_grid.max_column_count());
+
+      {
+         // A corrupt row (0,0xFFFFFFFF) must be rejected and the file re-indexed.
+         std::fstream stream(index_name.c_str(),std::ios::in | std::ios::out | std::ios::binary);
+         unsigned long long signature_size = 0;
+
+         stream.seekg(10 * sizeof(unsigned long long),std::ios::beg);
+         stream.read(reinterpret_cast<char*>(&signature_size),sizeof(signature_size));
+
+         const unsigned int row[2] = { 0, 0xFFFFFFFF };
+         stream.seekp(static_cast<std::streamoff>(13 * sizeof(unsigned long long) + ((signature_size + 7) / 8) * 8),std::ios::beg);
+         stream.write(reinterpret_cast<const char*>(row),sizeof(row));
+      }
+
+      strtk::token_grid corrupt_grid(file_name,options);
+
+      result = result && test_token_grid_equal(buffer_grid,corrupt_grid,"corrupt index");
+
+      {
+         // A same size replacement, possibly within the same second, is told apart by its inode.
+         const std::string replacement_name = file_name + ".new";
+         const std::string replacement_data = "a,b\nc,d,e\nf,g,h,i,j,kl\n";
+
+         {
+            std::ofstream stream(replacement_name.c_str(),std::ios::binary);
+            stream << replacement_data;
+         }
+
+         std::rename(replacement_name.c_str(),file_name.c_str());
+
+         strtk::token_grid replacement_buffer_grid(replacement_data,replacement_data.size(),options);
+         strtk::token_grid replacement_grid(file_name,options);
+
+         result = result && test_token_grid_equal(replacement_buffer_grid,replacement_grid,"replaced source");
+
+         {
+            std::ofstream stream(file_name.c_str(),std::ios::binary);
+            stream << data;
+         }
+      }
+
+      // A different delimiter set must not reuse the sidecar.
+      options.column_delimiters = ",b";
+
+      strtk::token_grid other_buffer_grid(data,data.size(),options);
+      strtk::token_grid other_grid(file_name,options);
+
+      result = result && test_token_grid_equal(other_buffer_grid,other_grid,"index mismatch");
+   }
+
+   std::remove(file_name.c_str());
+   std::remove(index_name.c_str());
+
+   if (!result)
+   {
+      std::cout << "test_token_grid_index_file() - failed" << std::endl;
+   }
+
+   return result;
+}
+
+bool test_token_grid_refresh()
+{
+   const std::string file_name = "strtk_token_grid_refresh.tmp";
+
+   // The second sequence loads with a double quoted row delimiter in its last row.
+   static const std::string data_list[][5] =
+                  {
+                     {
+                        "a,b,c\nd,e",
+                        "f\ng,h,i,j\nk",
+                        ",\"l\nm",
+                        "\",n\n",
+                        ""
+                     },
+                     {
+                        "a,b\nc,d,e\nf,\"g\nh",
+                        "\",i\nj",
+                        ",k,l,m\n",
+                        "n\n\"o\n",
+                        "p\"\n"
+                     }
+                  };
+
+   static const std::size_t data_list_size = sizeof(data_list) / sizeof(data_list[0]);
+   static const std::size_t data_size      = sizeof(data_list[0]) / sizeof(std::string);
+
+   bool result = true;
+
+   for (std::size_t mode = 0; result && (mode < (8 * data_list_size)); ++mode)
+   {
+      const std::string* data = data_list[mode / 8];
+
+      strtk::token_grid::options options;
+      options.column_delimiters = ",";
+      options.support_dquotes   = (0 != (mode & 1));
+      options.set_compact_token_index(0 != (mode & 2));
+      options.set_memory_map(0 != (mode & 4));
+
+      std::string file_data = data[0];
+
+      {
+         std::ofstream stream(file_name.c_str(),std::ios::binary);
+         stream << file_data;
+      }
+
+      strtk::token_grid grid(file_name,options);
+
+      for (std::size_t i = 1; result && (i < data_size); ++i)
+      {
+         {
+            std::ofstream stream(file_name.c_str(),std::ios::binary | std::ios::app);
+            stream << data[i];
+         }
+
+         file_data += data[i];
+
+         strtk::token_grid expected_grid(file_data,file_data.size(),options);
+
+         if (!grid.refresh())
+         {
+            std::cout << "test_token_grid_refresh() - refresh failed  mode: " << mode << " step: " << i << std::endl;
+            result = false;
+         }
+         else if (
+                  !test_token_grid_equal(expected_grid,grid,"refresh") ||
+                  (expected_grid.min_column_count() != grid.min_column_count()) ||
+                  (expected_grid.max_column_count() != grid.max_column_count())
+                 )
+         {
+            std::cout << "test_token_grid_refresh() - mismatch  mode: " << mode << " step: " << i << std::endl;
+            result = false;
+         }
+      }
+
+      if (result)
+      {
+         file_data = "x,y\n";
+
+         {
+            std::ofstream stream(file_name.c_str(),std::ios::binary);
+            stream << file_data;
+         }
+
+         strtk::token_grid expected_grid(file_data,file_data.size(),options);
+
+         if (!grid.refresh() || !test_token_grid_equal(expected_grid,grid,"refresh truncated"))
+         {
+            std::cout << "test_token_grid_refresh() - truncated file  mode: " << mode << std::endl;
+            result = false;
+         }
+      }
+   }
+
+   std::remove(file_name.c_str());
+
+   return result;
+}
+
+bool test_token_grid_delete()
+{
+   std::string data;
+   std::string expected_data;
+
+   for (std::size_t i = 0; i < 100; ++i)
+   {
+      const std::string row = strtk::type_to_string(i) + ",x," + strtk::type_to_string(i * 2) + "\n";
+
+      data += row;
+
+      if (0 != (i % 10))
+         expected_data += strtk::type_to_string(i) + "," + strtk::type_to_string(i * 2) + "\n";
+   }
+
+   for (std::size_t compact = 0; compact < 2; ++compact)
+   {
+      strtk::token_grid::options options;
+      options.column_delimiters = ",";
+      options.set_compact_token_index(1 == compact);
+
+      strtk::token_grid grid(data,data.size(),options);
+      strtk::token_grid expected_grid(expected_data,expected_data.size(),options);
+
+      struct multiple_of_ten
+      {
+         static inline bool test(const strtk::token_grid::row_type& row)
+         {
+            return 0 == (row.get<std::size_t>(0) % 10);
+         }
+      };
+
+      if (10 != grid.delete_row_if(multiple_of_ten::test))
+      {
+         std::cout << "test_token_grid_delete() - delete_row_if failed" << std::endl;
+         return false;
+      }
+
+      if (!grid.delete_column(1) || !grid.column_deleted(1) || grid.column_deleted(2))
+      {
+         std::cout << "test_token_grid_delete() - delete_column failed" << std::endl;
+         return false;
+      }
+
+      std::vector<std::size_t> column;
+      std::size_t sum = 0;
+
+      if (
+           (100 != grid.row_count())       ||
+           (10  != grid.deleted_row_count()) ||
+           !grid.row_deleted(50)           ||
+           grid.row_deleted(51)            ||
+           grid.extract_column(1,strtk::back_inserter_with_valuetype(column)) ||
+           !grid.extract_column(2,strtk::back_inserter_with_valuetype(column)) ||
+           (90 != column.size())           ||
+           (90 != grid.accumulate_column(0,sum))
+         )
+      {
+         std::cout << "test_token_grid_delete() - tombstone state failed" << std::endl;
+         return false;
+      }
+
+      std::size_t column_sum = 0;
+
+      for (std::size_t i = 0; i < column.size(); ++i)
+      {
+         column_sum += column[i];
+      }
+
+      if ((2 * 4500) != column_sum)
+      {
+         std::cout << "test_token_grid_delete() - extract_column failed" << std::endl;
+         return false;
+      }
+
+      grid.compact();
+
+      if (
+           (0 != grid.deleted_row_count()) ||
+           grid.column_deleted(1)          ||
+           (2 != grid.max_column_count())  ||
+           !test_token_grid_equal(expected_grid,grid,"compact")
+         )
+      {
+         std::cout << "test_token_grid_delete() - compact failed" << std::endl;
+         return false;
+      }
+
+      strtk::token_grid removed_grid(data,data.size(),options);
+      removed_grid.remove_row_if(multiple_of_ten::test);
+      removed_grid.delete_column(1);
+      removed_grid.delete_row(0);
+      removed_grid.remove_row(removed_grid.row_count() - 1);
+      expected_grid.remove_row(expected_grid.row_count() - 1);
+
+      // remove_row erases only its own row, the other marks stay pending.
+      if (!removed_grid.column_deleted(1) || !removed_grid.row_deleted(0) || (1 != removed_grid.deleted_row_count()))
+      {
+         std::cout << "test_token_grid_delete() - remove_row applied pending deletions" << std::endl;
+         return false;
+      }
+
+      removed_grid.compact();
+      expected_grid.remove_row(0);
+
+      if (!test_token_grid_equal(expected_grid,removed_grid,"remove_row_if"))
+         return false;
+
+      // Erasing a column keeps the rows it leaves without tokens.
+      const std::string single = "a\nb,c\nd,e\n";
+      strtk::token_grid single_grid(single,single.size(),options);
+
+      single_grid.delete_column(0);
+      single_grid.compact();
+
+      if ((3 != single_grid.row_count()) || (0 != single_grid.row(0).size()) || (1 != single_grid.row(2).size()))
+      {
+         std::cout << "test_token_grid_delete() - compact dropped rows" << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_token_grid_group_by()
+{
+   static const std::size_t row_count = 20000;
+   static const std::size_t key_count = 7;
+
+   std::string data;
+
+   std::vector<std::size_t> expected_rows (key_count,0);
+   std::vector<long long>   expected_sum0(key_count,0);
+   std::vector<long long>   expected_sum1(key_count,0);
+   std::vector<std::size_t> expected_count1(key_count,0);
+   std::vector<long long>   expected_min0(key_count,-1);
+   std::vector<long long>   expected_max0(key_count,-1);
+   std::vector<long long>   expected_min1(key_count,-1);
+   std::vector<long long>   expected_max1(key_count,-1);
+
+   for (std::size_t i = 0; i < row_count; ++i)
+   {
+      const std::size_t k = (i * 3) % key_count;
+
+      data += "key" + strtk::type_to_string(k) + "," + strtk::type_to_string(i) + ",";
+
+      ++expected_rows[k];
+      expected_sum0[k] += static_cast<long long>(i);
+      expected_max0[k]  = static_cast<long long>(i);
+
+      if (expected_min0[k] < 0)
+         expected_min0[k] = static_cast<long long>(i);
+
+      if (0 != (i % 5))
+      {
+         const long long v = static_cast<long long>(i % 13);
+
+         data += strtk::type_to_string(v);
+         expected_sum1[k] += v;
+         ++expected_count1[k];
+
+         if ((expected_min1[k] < 0) || (v < expected_min1[k])) expected_min1[k] = v;
+         if (v > expected_max1[k]) expected_max1[k] = v;
+      }
+      else
+         data += "x";
+
+      data += "\n";
+   }
+
+   data += "\n";
+
+   strtk::token_grid::options options;
+   options.column_delimiters = ",";
+
+   strtk::token_grid grid(data,data.size(),options);
+
+   std::vector<std::size_t> value_column_list;
+   value_column_list.push_back(1);
+   value_column_list.push_back(2);
+
+   for (std::size_t thread_count = 1; thread_count <= 4; thread_count *= 4)
+   {
+      strtk::token_grid::group_by_result<long long> result;
+
+      if (!grid.group_by(0,value_column_list,result,thread_count) || (key_count != result.size()))
+      {
+         std::cout << "test_token_grid_group_by() - group_by failed  threads: " << thread_count << std::endl;
+         return false;
+      }
+
+      for (std::size_t g = 0; g < result.size(); ++g)
+      {
+         const std::size_t k = strtk::string_to_type_converter<std::size_t>(result.key(g).substr(3));
+
+         if (
+              (result.key(g) != ("key" + strtk::type_to_string((g * 3) % key_count))) ||
+              (expected_rows[k]   != result.row_count[g])  ||
+              (expected_rows[k]   != result(g,0).count)    ||
+              (expected_sum0[k]   != result(g,0).sum)      ||
+              (expected_min0[k]   != result(g,0).min)      ||
+              (expected_max0[k]   != result(g,0).max)      ||
+              (expected_count1[k] != result(g,1).count)    ||
+              (expected_sum1[k]   != result(g,1).sum)      ||
+              (expected_min1[k]   != result(g,1).min)      ||
+              (expected_max1[k]   != result(g,1).max)
+            )
+         {
+            std::cout << "test_token_grid_group_by() - aggregate mismatch  threads: " << thread_count
+                      << " key: " << result.key(g) << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+struct join_pair_collector
+{
+   join_pair_collector(std::vector<std::pair<std::size_t,std::size_t> >& pair_list)
+   : pair_list_(pair_list)
+   {}
+
+   inline void operator()(const std::size_t& row, const std::size_t& other_row)
+   {
+      pair_list_.push_back(std::make_pair(row,other_row));
+   }
+
+   std::vector<std::pair<std::size_t,std::size_t> >& pair_list_;
+};
+
+bool test_token_grid_join()
+{
+   typedef std::vector<std::pair<std::size_t,std::size_t> > pair_list_t;
+
+   std::string reference_data;
+   std::string event_data;
+
+   for (std::size_t i = 0; i < 50; ++i)
+   {
+      reference_data += "id" + strtk::type_to_string(i) + ",name" + strtk::type_to_string(i) + "\n";
+   }
+
+   reference_data += "id7,duplicate\n";
+
+   for (std::size_t i = 0; i < 20000; ++i)
+   {
+      event_data += strtk::type_to_string(i) + ",id" + strtk::type_to_string((i * 7) % 60) + "\n";
+   }
+
+   strtk::token_grid::options options;
+   options.column_delimiters = ",";
+
+   strtk::token_grid reference(reference_data,reference_data.size(),options);
+   strtk::token_grid events(event_data,event_data.size(),options);
+
+   pair_list_t expected_inner;
+   pair_list_t expected_outer;
+
+   for (std::size_t i = 0; i < events.row_count(); ++i)
+   {
+      bool matched = false;
+
+      for (std::size_t j = 0; j < reference.row_count(); ++j)
+      {
+         if (events.row(i).get<std::string>(1) == reference.row(j).get<std::string>(0))
+         {
+            expected_inner.push_back(std::make_pair(i,j));
+            expected_outer.push_back(std::make_pair(i,j));
+            matched = true;
+         }
+      }
+
+      if (!matched)
+         expected_outer.push_back(std::make_pair(i,strtk::token_grid::null_row()));
+   }
+
+   pair_list_t inner;
+   pair_list_t outer;
+   pair_list_t reverse_inner;
+
+   events.join(1,reference,0,join_pair_collector(inner));
+   events.join(1,reference,0,join_pair_collector(outer),strtk::token_grid::left_outer_join);
+   reference.join(0,events,1,join_pair_collector(reverse_inner));
+
+   if ((expected_inner != inner) || (expected_outer != outer))
+   {
+      std::cout << "test_token_grid_join() - callback join failed" << std::endl;
+      return false;
+   }
+
+   for (std::size_t i = 0; i < reverse_inner.size(); ++i)
+   {
+      std::swap(reverse_inner[i].first,reverse_inner[i].second);
+   }
+
+   std::sort(reverse_inner.begin(),reverse_inner.end());
+
+   if (expected_inner != reverse_inner)
+   {
+      std::cout << "test_token_grid_join() - reverse callback join failed" << std::endl;
+      return false;
+   }
+
+   for (std::size_t thread_count = 1; thread_count <= 4; thread_count *= 4)
+   {
+      pair_list_t joined_index;
+
+      events.join(1,reference,0,joined_index,strtk::token_grid::inner_join,thread_count);
+
+      if (expected_inner != joined_index)
+      {
+         std::cout << "test_token_grid_join() - inner join index failed  threads: " << thread_count << std::endl;
+         return false;
+      }
+
+      events.join(1,reference,0,joined_index,strtk::token_grid::left_outer_join,thread_count);
+
+      if (expected_outer != joined_index)
+      {
+         std::cout << "test_token_grid_join() - left outer join index failed  threads: " << thread_count << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_token_grid_partial_load_rows(const strtk::token_grid& grid,
+                                       const std::size_t& first_row,
+                                       const std::size_t& stride,
+                                       const std::size_t& row_count,
+                                       const std::string& name)
+{
+   bool result = (row_count == grid.row_count());
+
+   for (std::size_t i = 0; result && (i < row_count); ++i)
+   {
+      result = ((first_row + i * stride) == grid.row(static_cast<unsigned int>(i)).get<std::size_t>(0)) &&
+               (2 == grid.row(static_cast<unsigned int>(i)).size());
+   }
+
+   if (!result)
+      std::cout << "test_token_grid_partial_load() - " << name << " failed" << std::endl;
+
+   return result;
+}
+
+bool test_token_grid_partial_load()
+{
+   const std::string file_name = "strtk_token_grid_partial_load.tmp";
+
+   std::string data;
+   std::vector<std::size_t> row_position;
+
+   for (std::size_t i = 0; i < 1000; ++i)
+   {
+      row_position.push_back(data.size());
+      data += strtk::type_to_string(i) + ",\"q\n" + strtk::type_to_string(i * 2) + "\"\n";
+   }
+
+   {
+      std::ofstream stream(file_name.c_str(),std::ios::binary);
+      stream << data;
+   }
+
+   bool result = true;
+
+   {
+      strtk::token_grid::options options;
+      options.column_delimiters = ",";
+      options.support_dquotes   = true;
+
+      // Quote state is unknown at an arbitrary offset, so start past the quoted newline.
+      options.set_byte_window(row_position[100] + 8, row_position[200] - row_position[100]);
+      strtk::token_grid grid(file_name,options);
+      result &= test_token_grid_partial_load_rows(grid,101,1,100,"byte window");
+
+      options.set_byte_window(row_position[300],row_position[310] - row_position[300]);
+      strtk::token_grid aligned_grid(file_name,options);
+      result &= test_token_grid_partial_load_rows(aligned_grid,300,1,10,"aligned byte window");
+
+      options.set_byte_window(0).set_row_window(250,10);
+      strtk::token_grid row_grid(file_name,options);
+      result &= test_token_grid_partial_load_rows(row_grid,250,1,10,"row window");
+
+      options.set_row_window(5,3).set_row_stride(100);
+      strtk::token_grid sample_grid(file_name,options);
+      result &= test_token_grid_partial_load_rows(sample_grid,5,100,3,"row stride");
+
+      strtk::token_grid buffer_grid(data,data.size(),options);
+      result &= test_token_grid_partial_load_rows(buffer_grid,5,100,3,"buffer row stride");
+
+      options.set_row_window(0).set_row_stride(250);
+      strtk::token_grid full_sample_grid(file_name,options);
+      result &= test_token_grid_partial_load_rows(full_sample_grid,0,250,4,"full file row stride");
+
+      options.set_row_window(990,100).set_row_stride(1);
+      strtk::token_grid tail_grid(file_name,options);
+      result &= test_token_grid_partial_load_rows(tail_grid,990,1,10,"row window past end");
+   }
+
+   data.clear();
+
+   for (std::size_t i = 0; i < 200000; ++i)
+   {
+      data += strtk::type_to_string(i) + ",abcdefghij\n";
+   }
+
+   {
+      std::ofstream stream(file_name.c_str(),std::ios::binary);
+      stream << data;
+   }
+
+   {
+      strtk::token_grid::options options;
+      options.column_delimiters = ",";
+
+      // Grows the buffer past its initial size while reading.
+      options.set_row_window(1000,150000);
+      strtk::token_grid long_grid(file_name,options);
+      result &= test_token_grid_partial_load_rows(long_grid,1000,1,150000,"long row window");
+
+      // Unselected rows are dropped as the file is streamed.
+      options.set_row_window(0).set_row_stride(100);
+      strtk::token_grid sparse_grid(file_name,options);
+      result &= test_token_grid_partial_load_rows(sparse_grid,0,100,2000,"sparse row stride");
+
+      if (sparse_grid.memory_footprint().buffer > ((data.size() / 50) + 64 * 1024))
+      {
+         std::cout << "test_token_grid_partial_load() - sparse row stride buffer too large" << std::endl;
+         result = false;
+      }
+   }
+
+   std::remove(file_name.c_str());
+
+   return result;
+}
+
+bool test_token_grid_memory_footprint()
+{
+   static const std::size_t row_count = 1000;
+
+   std::string data;
+
+   for (std::size_t i = 0; i < row_count; ++i)
+   {
+      data += strtk::type_to_string(i) + "," + strtk::type_to_string(i % 3) + ",x\n";
+   }
+
+   strtk::token_grid::options options;
+   options.column_delimiters = ",";
+
+   for (std::size_t compact = 0; compact < 2; ++compact)
+   {
+      options.set_compact_token_index(1 == compact);
+
+      const std::size_t token_size = (1 == compact) ? sizeof(strtk::compact_range) :
+                                                      sizeof(strtk::token_grid::range_t);
+
+      strtk::token_grid grid(data,data.size(),options);
+
+      strtk::token_grid::memory_usage usage = grid.memory_footprint();
+
+      // The index is sized once from the delimiter count: one extra row, and no growth.
+      if (
+           (0 != usage.buffer) ||
+           (((row_count + 1) * 2 * sizeof(unsigned int)) != usage.row_index) ||
+           (((row_count + 1) + (2 * row_count)) * token_size != usage.token_index)
+         )
+      {
+         std::cout << "test_token_grid_memory_footprint() - load footprint failed" << std::endl;
+         return false;
+      }
+
+      struct odd_row
+      {
+         static inline bool test(const strtk::token_grid::row_type& row)
+         {
+            return 1 == (row.get<std::size_t>(0) % 2);
+         }
+      };
+
+      grid.remove_row_if(odd_row::test);
+
+      if (usage.total() != grid.memory_footprint().total())
+      {
+         std::cout << "test_token_grid_memory_footprint() - remove_row_if changed capacity" << std::endl;
+         return false;
+      }
+
+      grid.compact();
+      usage = grid.memory_footprint();
+
+      if (
+           ((row_count / 2) * 2 * sizeof(unsigned int) != usage.row_index) ||
+           ((row_count / 2) * 3 * token_size != usage.token_index)
+         )
+      {
+         std::cout << "test_token_grid_memory_footprint() - compact footprint failed" << std::endl;
+         return false;
+      }
+   }
+
+   std::string crlf_data;
+   std::string quoted_data;
+
+   for (std::size_t i = 0; i < row_count; ++i)
+   {
+      crlf_data   += strtk::type_to_string(i) + ",x\r\n";
+      quoted_data += strtk::type_to_string(i) + ",\"a\nb\nc\nd\"\n";
+   }
+
+   options.set_compact_token_index(false);
+
+   // A CRLF pair ends a single row.
+   strtk::token_grid crlf_grid(crlf_data,crlf_data.size(),options);
+
+   if (((row_count + 1) * 2 * sizeof(unsigned int)) != crlf_grid.memory_footprint().row_index)
+   {
+      std::cout << "test_token_grid_memory_footprint() - crlf footprint failed" << std::endl;
+      return false;
+   }
+
+   // Quoted row delimiters overshoot the estimate, which is then released.
+   options.support_dquotes = true;
+   strtk::token_grid quoted_grid(quoted_data,quoted_data.size(),options);
+
+   if (
+        (row_count != quoted_grid.row_count()) ||
+        ((row_count * 2 * sizeof(unsigned int)) != quoted_grid.memory_footprint().row_index)
+      )
+   {
+      std::cout << "test_token_grid_memory_footprint() - quoted footprint failed" << std::endl;
+      return false;
+   }
+
+   return true;
+}
+
+struct data_block
+{
+   std::string    d1;
+   char           d2;
+   int            d3;
+   unsigned int   d4;
+   double         d5;
+   float          d6;
+   short          d7;
+   unsigned short d8;
+   bool           d9;
+   unsigned char  d10;
+
+   void clear(const std::size_t& i)
+   {
+      if (i >=  1) d1  = "";
+      if (i >=  2) d2  = 0x00;
+      if (i >=  3) d3  = 0;
+      if (i >=  4) d4  = 0;
+      if (i >=  5) d5  = 0;
+      if (i >=  6) d6  = 0;
+      if (i >=  7) d7  = 7;
+      if (i >=  8) d8  = 0;
+      if (i >=  9) d9  = false;
+      if (i >= 10) d10 = 0x00;
+   }
+
+   bool operator==(const data_block& db)
+   {
+      return d1 == db.d1 &&
+             d2 == db.d2 &&
+             d3 == db.d3 &&
+             d4 == db.d4 &&
+    !not_equal(d5,db.d5) &&
+    !not_equal(d6,db.d6) &&
+             d7 == db.d7 &&
+             d8 == db.d8 &&
+             d9 == db.d9 &&
+             d10 == db.d10;
+   }
+
+   bool operator!=(const data_block& db)
+   {
+      return !this->operator ==(db);
+   }
+};
+
+inline void std_double_to_string(const double& d, std::string& s)
+{
+   char buffer[128];
+   std::size_t sz = sprintf(buffer,"%20.19e",d);
+   buffer[sz] = 0;
+   s.assign(buffer);
+}
+
+inline bool strtk_isnan(const double& v)
+{
+   volatile double d = v;
+   return d != d;
+}
+
+bool test_fast_convert()
+{
+   {
+      int v = 0;
+      for (int i = -100000000; i < +100000000; ++i)
+      {
+         if (!strtk::fast::signed_numeric_convert(strtk::type_to_string(i),v,true))
+         {
+            std::cout << "test_fast_convert() - Failed Fast convert 1  i = " << i << std::endl;
+         }
+
+         if (i != v)
+         {
+            std::cout << "test_fast_convert() - Failed Fast convert 2 "
+                      << " i = " << i
+                      << " v = " << v << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      unsigned int v = 0;
+      for (unsigned int i = 0; i < 1000000000; ++i)
+      {
+         if (!strtk::fast::numeric_convert(strtk::type_to_string(i),v,true))
+         {
+            std::cout << "test_fast_convert() - Failed Fast convert 1  i = " << i << std::endl;
+         }
+
+         if (i != v)
+         {
+            std::cout << "test_fast_convert() - Failed Fast convert 2  "
+                      << "i = " << i
+                      << "v = " << v << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      std::string s[] = {
+                            "0000000000000000",   "1111111111111111",   "2222222222222222",   "3333333333333333",   "4444444444444444",
+                            "5555555555555555",   "6666666666666666",   "1234567890123456",   "9876543210987654",   "1919191919191919",
+                           "00000000000000000",  "11111111111111111",  "22222222222222222",  "33333333333333333",  "44444444444444444",
+                           "55555555555555555",  "66666666666666666",  "12345678901234567",  "98765432109876543",  "19191919191919191",
+                          "000000000000000000", "111111111111111111", "222222222222222222", "333333333333333333", "444444444444444444",
+                          "555555555555555555", "666666666666666666", "123456789012345677", "987654321098765432", "191919191919191919"
+                        };
+
+      unsigned long long v[] = {
+                              0000000000000000LL,   1111111111111111LL,   2222222222222222LL,   3333333333333333LL,   4444444444444444LL,
+                              5555555555555555LL,   6666666666666666LL,   1234567890123456LL,   9876543210987654LL,   1919191919191919LL,
+                             00000000000000000LL,  11111111111111111LL,  22222222222222222LL,  33333333333333333LL,  44444444444444444LL,
+                             55555555555555555LL,  66666666666666666LL,  12345678901234567LL,  98765432109876543LL,  19191919191919191LL,
+                            000000000000000000LL, 111111111111111111LL, 222222222222222222LL, 333333333333333333LL, 444444444444444444LL,
+                            555555555555555555LL, 666666666666666666LL, 123456789012345677LL, 987654321098765432LL, 191919191919191919LL
+                        };
+
+      for (std::size_t i = 0 ; i < (sizeof(s) / sizeof(std::string)); ++i)
+      {
+         unsigned long long t = 0;
+         strtk::fast::numeric_convert(s[i],t);
+         if (t != v[i])
+         {
+            strtk::fast::numeric_convert(s[i],t);
+
+            std::cout << "test_fast_convert() - Failed Fast convert Special Test unsigned long long "
+                      << " index = " << i
+                      << " t = " << t
+                      << " v[index] = " << v[i] << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+
+}
+
+bool test_double_convert()
+{
+   {
+      static const std::string fract10_str[] =
+                   {
+                      "0.0",
+                      "1.0E+001", "1.0E+002", "1.0E+003", "1.0E+004", "1.0E+005", "1.0E+006", "1.0E+007", "1.0E+008", "1.0E+009", "1.0E+010",
+                      "1.0E+011", "1.0E+012", "1.0E+013", "1.0E+014", "1.0E+015", "1.0E+016", "1.0E+017", "1.0E+018", "1.0E+019", "1.0E+020",
+                      "1.0E+021", "1.0E+022", "1.0E+023", "1.0E+024", "1.0E+025", "1.0E+026", "1.0E+027", "1.0E+028", "1.0E+029", "1.0E+030",
+                      "1.0E+031", "1.0E+032", "1.0E+033", "1.0E+034", "1.0E+035", "1.0E+036", "1.0E+037", "1.0E+038", "1.0E+039", "1.0E+040",
+                      "1.0E+041", "1.0E+042", "1.0E+043", "1.0E+044", "1.0E+045", "1.0E+046", "1.0E+047", "1.0E+048", "1.0E+049", "1.0E+050",
+                      "1.0E+051", "1.0E+052", "1.0E+053", "1.0E+054", "1.0E+055", "1.0E+056", "1.0E+057", "1.0E+058", "1.0E+059", "1.0E+060",
+                      "1.0E+061", "1.0E+062", "1.0E+063", "1.0E+064", "1.0E+065", "1.0E+066", "1.0E+067", "1.0E+068", "1.0E+069", "1.0E+070",
+                      "1.0E+071", "1.0E+072", "1.0E+073", "1.0E+074", "1.0E+075", "1.0E+076", "1.0E+077", "1.0E+078", "1.0E+079", "1.0E+080",
+                      "1.0E+081", "1.0E+082", "1.0E+083", "1.0E+084", "1.0E+085", "1.0E+086", "1.0E+087", "1.0E+088", "1.0E+089", "1.0E+090",
+                      "1.0E+091", "1.0E+092", "1.0E+093", "1.0E+094", "1.0E+095", "1.0E+096", "1.0E+097", "1.0E+098", "1.0E+099", "1.0E+100",
+                      "1.0E+101", "1.0E+102", "1.0E+103", "1.0E+104", "1.0E+105", "1.0E+106", "1.0E+107", "1.0E+108", "1.0E+109", "1.0E+110",
+                      "1.0E+111", "1.0E+112", "1.0E+113", "1.0E+114", "1.0E+115", "1.0E+116", "1.0E+117", "1.0E+118", "1.0E+119", "1.0E+120",
+                      "1.0E+121", "1.0E+122", "1.0E+123", "1.0E+124", "1.0E+125", "1.0E+126", "1.0E+127", "1.0E+128", "1.0E+129", "1.0E+130",
+                      "1.0E+131", "1.0E+132", "1.0E+133", "1.0E+134", "1.0E+135", "1.0E+136", "1.0E+137", "1.0E+138", "1.0E+139", "1.0E+140",
+                      "1.0E+141", "1.0E+142", "1.0E+143", "1.0E+144", "1.0E+145", "1.0E+146", "1.0E+147", "1.0E+148", "1.0E+149", "1.0E+150",
+                      "1.0E+151", "1.0E+152", "1.0E+153", "1.0E+154", "1.0E+155", "1.0E+156", "1.0E+157", "1.0E+158", "1.0E+159", "1.0E+160",
+                      "1.0E+161", "1.0E+162", "1.0E+163", "1.0E+164", "1.0E+165", "1.0E+166", "1.0E+167", "1.0E+168", "1.0E+169", "1.0E+170",
+                      "1.0E+171", "1.0E+172", "1.0E+173", "1.0E+174", "1.0E+175", "1.0E+176", "1.0E+177", "1.0E+178", "1.0E+179", "1.0E+180",
+                      "1.0E+181", "1.0E+182", "1.0E+183", "1.0E+184", "1.0E+185", "1.0E+186", "1.0E+187", "1.0E+188", "1.0E+189", "1.0E+190",
+                      "1.0E+191", "1.0E+192", "1.0E+193", "1.0E+194", "1.0E+195", "1.0E+196", "1.0E+197", "1.0E+198", "1.0E+199", "1.0E+200",
+                      "1.0E+201", "1.0E+202", "1.0E+203", "1.0E+204", "1.0E+205", "1.0E+206", "1.0E+207", "1.0E+208", "1.0E+209", "1.0E+210",
+                      "1.0E+211", "1.0E+212", "1.0E+213", "1.0E+214", "1.0E+215", "1.0E+216", "1.0E+217", "1.0E+218", "1.0E+219", "1.0E+220",
+                      "1.0E+221", "1.0E+222", "1.0E+223", "1.0E+224", "1.0E+225", "1.0E+226", "1.0E+227", "1.0E+228", "1.0E+229", "1.0E+230",
+                      "1.0E+231", "1.0E+232", "1.0E+233", "1.0E+234", "1.0E+235", "1.0E+236", "1.0E+237", "1.0E+238", "1.0E+239", "1.0E+240",
+                      "1.0E+241", "1.0E+242", "1.0E+243", "1.0E+244", "1.0E+245", "1.0E+246", "1.0E+247", "1.0E+248", "1.0E+249", "1.0E+250",
+                      "1.0E+251", "1.0E+252", "1.0E+253", "1.0E+254", "1.0E+255", "1.0E+256", "1.0E+257", "1.0E+258", "1.0E+259", "1.0E+260",
+                      "1.0E+261", "1.0E+262", "1.0E+263", "1.0E+264", "1.0E+265", "1.0E+266", "1.0E+267", "1.0E+268", "1.0E+269", "1.0E+270",
+                      "1.0E+271", "1.0E+272", "1.0E+273", "1.0E+274", "1.0E+275", "1.0E+276", "1.0E+277", "1.0E+278", "1.0E+279", "1.0E+280",
+                      "1.0E+281", "1.0E+282", "1.0E+283", "1.0E+284", "1.0E+285", "1.0E+286", "1.0E+287", "1.0E+288", "1.0E+289", "1.0E+290",
+                      "1.0E+291", "1.0E+292", "1.0E+293", "1.0E+294", "1.0E+295", "1.0E+296", "1.0E+297", "1.0E+298", "1.0E+299", "1.0E+300",
+                      "1.0E+301", "1.0E+302", "1.0E+303", "1.0E+304", "1.0E+305", "1.0E+306", "1.0E+307", "1.0E+308"
+                   };
+
+      const std::size_t dbl_size = sizeof(fract10_str) / sizeof(std::string);
+
+      bool result = true;
+
+      for (std::size_t i = 1; i < dbl_size; ++i)
+      {
+         double d = std::numeric_limits<double>::quiet_NaN();
+
+         if (!strtk::string_to_type_converter(fract10_str[i],d))
+         {
+            std::cout << "test_double_convert() exp10 test convert failure [" << i << "] "
+                      << "str: ["<< fract10_str[i] << "]" << std::endl;
+            result = false;
+         }
+
+         if (not_equal(d,std::pow(10.0,1.0 * i)))
+         {
+            std::cout << "test_double_convert() exp10 test value check failure [" << i << "] "
+                      << "str: ["  << fract10_str[i] << "]  "
+                      << "value: " << d << " "
+                      << "cmpv : " << std::pow(10.0,1.0 * i) << std::endl;
+            result= false;
+         }
+      }
+
+      if (!result)
+         return false;
+   }
+
+   {
+      static const std::string double_str[] =
+                  {
+                       "7379973.6624700",          "+2187496.9290991",            "384281.3720002",
+                     "06603499.49182570",            "-80173.0014819",             "+00693.000285",
+                            "-0.6366299",             "+0.2335175000",               "-00.6366299",
                         "+00.2335175000",              "-000.6366299",           "+000.2335175000",
                              "123.456e3",                 "123.456E3",                "123.456e+3",
                             "123.456E+3",                "123.456e03",                "123.456E03",
@@ -1062,258 +2875,852 @@ bool test_double_convert()
              std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(),
            };
 
-      std::size_t d_size = sizeof(double_str) / sizeof(std::string);
+      std::size_t d_size = sizeof(double_str) / sizeof(std::string);
+
+      double v = 0.0;
+      for (std::size_t i = 0; i < d_size; ++i)
+      {
+         v = 0.0;
+         if (!strtk::string_to_type_converter(double_str[i],v))
+         {
+            std::cout << "test_double_convert() double convert[" << i << "]"
+                      << " dblstr: [" << double_str[i] << "]" << std::endl;
+            return false;
+         }
+
+         if (not_equal(d[i],v) && (!strtk_isnan(v)))
+         {
+            std::cout << "test_double_convert() double check[" << i << "]"
+                      << " dblstr: [" << double_str[i] << "]" << std::endl;
+            return false;
+         }
+      }
+
+      static const std::string bad_list[] =
+                          {
+                             "1234567.8A",      "1234567.A",      "12345A67.8",      "A1234567.8A",
+                            "1234567.8Ae", "1234567.AE+100", "12345A67.8e+100", "A1234567.8AE+100",
+                            "--1.234e+10",    "++1.234e+10",      "1.234e+10-",       "1.234e+10+",
+                             "1.234e++10",     "1.234E--10",         "1.e++10",          "1.E--10",
+                             "1..234e+10",     "1.23.4E-10",      "1.234e-1.0",            "1.23x",
+                             "1.23e+100y",               "",            "123+",             "123-",
+                                  "123.+",          "123.-",           "123+.",            "123-.",
+                               "123..123",       "123.-123",        "123.+123",           "123-.0",
+                                                             "+", "-", "+.", "-.", ".+", ".-", ".",
+                                                      "++", "--", "++.", "--.", ".++", ".--", "..",
+                                                      "+f", "-f", "+.f", "-.f", ".+f", ".-f", ".f",
+                                                      "+l", "-l", "+.l", "-.l", ".+l", ".-l", ".l",
+                              ".+0", ".+1", ".+2", ".+3", ".+4", ".+5", ".+6", ".+7", ".+8", ".+9",
+                              ".-0", ".-1", ".-2", ".-3", ".-4", ".-5", ".-6", ".-7", ".-8", ".-9",
+                    "..+0", "..+1", "..+2", "..+3", "..+4", "..+5", "..+6", "..+7", "..+8", "..+9",
+                    "..-0", "..-1", "..-2", "..-3", "..-4", "..-5", "..-6", "..-7", "..-8", "..-9",
+                    ".+0f", ".+1F", ".+2f", ".+3F", ".+4f", ".+5F", ".+6f", ".+7F", ".+8f", ".+9F",
+                    ".-0l", ".-1L", ".-2l", ".-3L", ".-4l", ".-5L", ".-6l", ".-7L", ".-8l", ".-9L"
+                          };
+
+      static const std::size_t bad_list_size = sizeof(bad_list) / sizeof(std::string);
+
+      for (std::size_t i = 0; i < bad_list_size; ++i)
+      {
+         if (strtk::string_to_type_converter(bad_list[i],v))
+         {
+            std::cout << "test_double_convert() bad test failure [" << i << "]  - [" << bad_list[i] << "]" << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      static const std::size_t count = 10000000;
+      std::string s;
+      s.reserve(32);
+      double t = 0.0;
+
+      for (int i = -static_cast<int>(count); i < static_cast<int>(count); ++i)
+      {
+         if (!strtk::type_to_string(i,s))
+         {
+            std::cout << "test_double_convert() - Failed int to string @ " << i << std::endl;
+            return false;
+         }
+
+         if (!strtk::string_to_type_converter(s,t))
+         {
+            std::cout << "test_double_convert() - Failed string to double @ " << i << std::endl;
+            return false;
+         }
+
+         if (static_cast<double>(i) != t)
+         {
+            std::cout << "test_double_convert() - Failed i == t @ " << i << std::endl;
+            return false;
+         }
+
+         s.clear();
+      }
+   }
+
+   {
+      std::string s;
+      s.reserve(256);
+
+      double v = -111111.11;
+      double t = 0.0;
+
+      while (v < +111111.11)
+      {
+         std_double_to_string(v,s);
+         if (!strtk::string_to_type_converter(s,t))
+         {
+            std::cout << "test_double_convert() - Failed decimal to string,  t: " << t << std::endl;
+            return false;
+         }
+
+         if (not_equal(t,v,0.0000000001))
+         {
+            std::cout << "test_double_convert() - Failed decimal r == t  r: " << t << std::endl;
+            return false;
+         }
+
+         v += 0.01;
+         s.clear();
+         t = 0.0;
+      }
+   }
+
+   {
+      double d1 = +123.456;
+      double d2 = -123.456;
+      double delta[] =
+             {
+               0.333,   0.555,   0.777,
+               0.999, 0.13579, 0.97531
+             };
+      std::size_t delta_size = sizeof(delta) / sizeof(double);
+
+      std::string s;
+      s.reserve(256);
+      double tmp = 0.0;
+
+      for (int i = 0; i < 1000000; ++i)
+      {
+         std_double_to_string(d1,s);
+
+         if (!strtk::string_to_type_converter(s,tmp))
+         {
+            std::cout << "test_double_convert() - (1) final test string to double failure @ " << i << std::endl;
+            return false;
+         }
+
+         if (not_equal(d1,tmp,0.000000001))
+         {
+            std::cout << "test_double_convert() - (1) final test compare failure @ " << i << std::endl;
+            return false;
+         }
+
+         d1 += delta[std::abs(i) % delta_size];
+
+         std_double_to_string(d2,s);
+
+         if (!strtk::string_to_type_converter(s,tmp))
+         {
+            std::cout << "test_double_convert() - (2) final test string to double failure @ " << i << std::endl;
+            return false;
+         }
+
+         if (not_equal(d2,tmp,0.000000001))
+         {
+            std::cout << "test_double_convert() - (2) final test compare failure @ " << i << std::endl;
+            return false;
+         }
+
+         d2 -= delta[std::abs(i) % delta_size];
+      }
+   }
+
+   {
+      static const std::string dbl_str_list[] =
+                                  {
+                                     "0.0",
+                                     "1.0E+001", "1.0E+002", "1.0E+003", "1.0E+004", "1.0E+005", "1.0E+006", "1.0E+007", "1.0E+008", "1.0E+009", "1.0E+010",
+                                     "1.0E+011", "1.0E+012", "1.0E+013", "1.0E+014", "1.0E+015", "1.0E+016", "1.0E+017", "1.0E+018", "1.0E+019", "1.0E+020",
+                                     "1.0E+021", "1.0E+022", "1.0E+023", "1.0E+024", "1.0E+025", "1.0E+026", "1.0E+027", "1.0E+028", "1.0E+029", "1.0E+030",
+                                     "1.0E+031", "1.0E+032", "1.0E+033", "1.0E+034", "1.0E+035", "1.0E+036", "1.0E+037", "1.0E+038", "1.0E+039", "1.0E+040",
+                                     "1.0E+041", "1.0E+042", "1.0E+043", "1.0E+044", "1.0E+045", "1.0E+046", "1.0E+047", "1.0E+048", "1.0E+049", "1.0E+050",
+                                     "1.0E+051", "1.0E+052", "1.0E+053", "1.0E+054", "1.0E+055", "1.0E+056", "1.0E+057", "1.0E+058", "1.0E+059", "1.0E+060",
+                                     "1.0E+061", "1.0E+062", "1.0E+063", "1.0E+064", "1.0E+065", "1.0E+066", "1.0E+067", "1.0E+068", "1.0E+069", "1.0E+070",
+                                     "1.0E+071", "1.0E+072", "1.0E+073", "1.0E+074", "1.0E+075", "1.0E+076", "1.0E+077", "1.0E+078", "1.0E+079", "1.0E+080",
+                                     "1.0E+081", "1.0E+082", "1.0E+083", "1.0E+084", "1.0E+085", "1.0E+086", "1.0E+087", "1.0E+088", "1.0E+089", "1.0E+090",
+                                     "1.0E+091", "1.0E+092", "1.0E+093", "1.0E+094", "1.0E+095", "1.0E+096", "1.0E+097", "1.0E+098", "1.0E+099", "1.0E+100",
+                                     "1.0E+101", "1.0E+102", "1.0E+103", "1.0E+104", "1.0E+105", "1.0E+106", "1.0E+107", "1.0E+108", "1.0E+109", "1.0E+110",
+                                     "1.0E+111", "1.0E+112", "1.0E+113", "1.0E+114", "1.0E+115", "1.0E+116", "1.0E+117", "1.0E+118", "1.0E+119", "1.0E+120",
+                                     "1.0E+121", "1.0E+122", "1.0E+123", "1.0E+124", "1.0E+125", "1.0E+126", "1.0E+127", "1.0E+128", "1.0E+129", "1.0E+130",
+                                     "1.0E+131", "1.0E+132", "1.0E+133", "1.0E+134", "1.0E+135", "1.0E+136", "1.0E+137", "1.0E+138", "1.0E+139", "1.0E+140",
+                                     "1.0E+141", "1.0E+142", "1.0E+143", "1.0E+144", "1.0E+145", "1.0E+146", "1.0E+147", "1.0E+148", "1.0E+149", "1.0E+150",
+                                     "1.0E+151", "1.0E+152", "1.0E+153", "1.0E+154", "1.0E+155", "1.0E+156", "1.0E+157", "1.0E+158", "1.0E+159", "1.0E+160",
+                                     "1.0E+161", "1.0E+162", "1.0E+163", "1.0E+164", "1.0E+165", "1.0E+166", "1.0E+167", "1.0E+168", "1.0E+169", "1.0E+170",
+                                     "1.0E+171", "1.0E+172", "1.0E+173", "1.0E+174", "1.0E+175", "1.0E+176", "1.0E+177", "1.0E+178", "1.0E+179", "1.0E+180",
+                                     "1.0E+181", "1.0E+182", "1.0E+183", "1.0E+184", "1.0E+185", "1.0E+186", "1.0E+187", "1.0E+188", "1.0E+189", "1.0E+190",
+                                     "1.0E+191", "1.0E+192", "1.0E+193", "1.0E+194", "1.0E+195", "1.0E+196", "1.0E+197", "1.0E+198", "1.0E+199", "1.0E+200",
+                                     "1.0E+201", "1.0E+202", "1.0E+203", "1.0E+204", "1.0E+205", "1.0E+206", "1.0E+207", "1.0E+208", "1.0E+209", "1.0E+210",
+                                     "1.0E+211", "1.0E+212", "1.0E+213", "1.0E+214", "1.0E+215", "1.0E+216", "1.0E+217", "1.0E+218", "1.0E+219", "1.0E+220",
+                                     "1.0E+221", "1.0E+222", "1.0E+223", "1.0E+224", "1.0E+225", "1.0E+226", "1.0E+227", "1.0E+228", "1.0E+229", "1.0E+230",
+                                     "1.0E+231", "1.0E+232", "1.0E+233", "1.0E+234", "1.0E+235", "1.0E+236", "1.0E+237", "1.0E+238", "1.0E+239", "1.0E+240",
+                                     "1.0E+241", "1.0E+242", "1.0E+243", "1.0E+244", "1.0E+245", "1.0E+246", "1.0E+247", "1.0E+248", "1.0E+249", "1.0E+250",
+                                     "1.0E+251", "1.0E+252", "1.0E+253", "1.0E+254", "1.0E+255", "1.0E+256", "1.0E+257", "1.0E+258", "1.0E+259", "1.0E+260",
+                                     "1.0E+261", "1.0E+262", "1.0E+263", "1.0E+264", "1.0E+265", "1.0E+266", "1.0E+267", "1.0E+268", "1.0E+269", "1.0E+270",
+                                     "1.0E+271", "1.0E+272", "1.0E+273", "1.0E+274", "1.0E+275", "1.0E+276", "1.0E+277", "1.0E+278", "1.0E+279", "1.0E+280",
+                                     "1.0E+281", "1.0E+282", "1.0E+283", "1.0E+284", "1.0E+285", "1.0E+286", "1.0E+287", "1.0E+288", "1.0E+289", "1.0E+290",
+                                     "1.0E+291", "1.0E+292", "1.0E+293", "1.0E+294", "1.0E+295", "1.0E+296", "1.0E+297", "1.0E+298", "1.0E+299", "1.0E+300",
+                                     "1.0E+301", "1.0E+302", "1.0E+303", "1.0E+304", "1.0E+305", "1.0E+306", "1.0E+307", "1.0E+308"
+                                  };
+      static const std::size_t dbl_str_list_size = sizeof(dbl_str_list) / sizeof(std::string);
+
+      static const double dbl_list[] =
+                                  {
+                                     0.0,
+                                     1.0E+001, 1.0E+002, 1.0E+003, 1.0E+004, 1.0E+005, 1.0E+006, 1.0E+007, 1.0E+008, 1.0E+009, 1.0E+010,
+                                     1.0E+011, 1.0E+012, 1.0E+013, 1.0E+014, 1.0E+015, 1.0E+016, 1.0E+017, 1.0E+018, 1.0E+019, 1.0E+020,
+                                     1.0E+021, 1.0E+022, 1.0E+023, 1.0E+024, 1.0E+025, 1.0E+026, 1.0E+027, 1.0E+028, 1.0E+029, 1.0E+030,
+                                     1.0E+031, 1.0E+032, 1.0E+033, 1.0E+034, 1.0E+035, 1.0E+036, 1.0E+037, 1.0E+038, 1.0E+039, 1.0E+040,
+                                     1.0E+041, 1.0E+042, 1.0E+043, 1.0E+044, 1.0E+045, 1.0E+046, 1.0E+047, 1.0E+048, 1.0E+049, 1.0E+050,
+                                     1.0E+051, 1.0E+052, 1.0E+053, 1.0E+054, 1.0E+055, 1.0E+056, 1.0E+057, 1.0E+058, 1.0E+059, 1.0E+060,
+                                     1.0E+061, 1.0E+062, 1.0E+063, 1.0E+064, 1.0E+065, 1.0E+066, 1.0E+067, 1.0E+068, 1.0E+069, 1.0E+070,
+                                     1.0E+071, 1.0E+072, 1.0E+073, 1.0E+074, 1.0E+075, 1.0E+076, 1.0E+077, 1.0E+078, 1.0E+079, 1.0E+080,
+                                     1.0E+081, 1.0E+082, 1.0E+083, 1.0E+084, 1.0E+085, 1.0E+086, 1.0E+087, 1.0E+088, 1.0E+089, 1.0E+090,
+                                     1.0E+091, 1.0E+092, 1.0E+093, 1.0E+094, 1.0E+095, 1.0E+096, 1.0E+097, 1.0E+098, 1.0E+099, 1.0E+100,
+                                     1.0E+101, 1.0E+102, 1.0E+103, 1.0E+104, 1.0E+105, 1.0E+106, 1.0E+107, 1.0E+108, 1.0E+109, 1.0E+110,
+                                     1.0E+111, 1.0E+112, 1.0E+113, 1.0E+114, 1.0E+115, 1.0E+116, 1.0E+117, 1.0E+118, 1.0E+119, 1.0E+120,
+                                     1.0E+121, 1.0E+122, 1.0E+123, 1.0E+124, 1.0E+125, 1.0E+126, 1.0E+127, 1.0E+128, 1.0E+129, 1.0E+130,
+                                     1.0E+131, 1.0E+132, 1.0E+133, 1.0E+134, 1.0E+135, 1.0E+136, 1.0E+137, 1.0E+138, 1.0E+139, 1.0E+140,
+                                     1.0E+141, 1.0E+142, 1.0E+143, 1.0E+144, 1.0E+145, 1.0E+146, 1.0E+147, 1.0E+148, 1.0E+149, 1.0E+150,
+                                     1.0E+151, 1.0E+152, 1.0E+153, 1.0E+154, 1.0E+155, 1.0E+156, 1.0E+157, 1.0E+158, 1.0E+159, 1.0E+160,
+                                     1.0E+161, 1.0E+162, 1.0E+163, 1.0E+164, 1.0E+165, 1.0E+166, 1.0E+167, 1.0E+168, 1.0E+169, 1.0E+170,
+                                     1.0E+171, 1.0E+172, 1.0E+173, 1.0E+174, 1.0E+175, 1.0E+176, 1.0E+177, 1.0E+178, 1.0E+179, 1.0E+180,
+                                     1.0E+181, 1.0E+182, 1.0E+183, 1.0E+184, 1.0E+185, 1.0E+186, 1.0E+187, 1.0E+188, 1.0E+189, 1.0E+190,
+                                     1.0E+191, 1.0E+192, 1.0E+193, 1.0E+194, 1.0E+195, 1.0E+196, 1.0E+197, 1.0E+198, 1.0E+199, 1.0E+200,
+                                     1.0E+201, 1.0E+202, 1.0E+203, 1.0E+204, 1.0E+205, 1.0E+206, 1.0E+207, 1.0E+208, 1.0E+209, 1.0E+210,
+                                     1.0E+211, 1.0E+212, 1.0E+213, 1.0E+214, 1.0E+215, 1.0E+216, 1.0E+217, 1.0E+218, 1.0E+219, 1.0E+220,
+                                     1.0E+221, 1.0E+222, 1.0E+223, 1.0E+224, 1.0E+225, 1.0E+226, 1.0E+227, 1.0E+228, 1.0E+229, 1.0E+230,
+                                     1.0E+231, 1.0E+232, 1.0E+233, 1.0E+234, 1.0E+235, 1.0E+236, 1.0E+237, 1.0E+238, 1.0E+239, 1.0E+240,
+                                     1.0E+241, 1.0E+242, 1.0E+243, 1.0E+244, 1.0E+245, 1.0E+246, 1.0E+247, 1.0E+248, 1.0E+249, 1.0E+250,
+                                     1.0E+251, 1.0E+252, 1.0E+253, 1.0E+254, 1.0E+255, 1.0E+256, 1.0E+257, 1.0E+258, 1.0E+259, 1.0E+260,
+                                     1.0E+261, 1.0E+262, 1.0E+263, 1.0E+264, 1.0E+265, 1.0E+266, 1.0E+267, 1.0E+268, 1.0E+269, 1.0E+270,
+                                     1.0E+271, 1.0E+272, 1.0E+273, 1.0E+274, 1.0E+275, 1.0E+276, 1.0E+277, 1.0E+278, 1.0E+279, 1.0E+280,
+                                     1.0E+281, 1.0E+282, 1.0E+283, 1.0E+284, 1.0E+285, 1.0E+286, 1.0E+287, 1.0E+288, 1.0E+289, 1.0E+290,
+                                     1.0E+291, 1.0E+292, 1.0E+293, 1.0E+294, 1.0E+295, 1.0E+296, 1.0E+297, 1.0E+298, 1.0E+299, 1.0E+300,
+                                     1.0E+301, 1.0E+302, 1.0E+303, 1.0E+304, 1.0E+305, 1.0E+306, 1.0E+307, 1.0E+308
+                                  };
+
+      for (std::size_t i = 0; i < dbl_str_list_size; ++i)
+      {
+         double d = std::numeric_limits<double>::quiet_NaN();
 
-      double v = 0.0;
-      for (std::size_t i = 0; i < d_size; ++i)
+         if (!strtk::string_to_type_converter(dbl_str_list[i],d))
+         {
+            std::cout << "test_double_convert() - Failed frac-table string to double: " << dbl_str_list[i] << std::endl;
+            return false;
+         }
+
+         if (not_equal(dbl_list[i],d,0.0000000001))
+         {
+            std::cout << "test_double_convert() - Failed frac-table i == d: " << dbl_str_list[i] << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+template <typename T>
+inline bool same_real(const T& t1, const T& t2)
+{
+   return (0 == std::memcmp(&t1,&t2,sizeof(T)));
+}
+
+bool test_double_convert_rounding()
+{
+   {
+      static const char* hard_list[] =
+                   {
+                      "0.1", "0.3", "3.14159265358979323846264338327950288",
+                      "1e23", "8.988465674311579e307", "9007199254740993", "9007199254740992.5",
+                      "2.2250738585072014e-308", "2.2250738585072011e-308",
+                      "4.9406564584124654e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+                      "1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308",
+                      "1.00000000000000011102230246251565404236316680908203125",
+                      "1.00000000000000011102230246251565404236316680908203124",
+                      "1.00000000000000011102230246251565404236316680908203126",
+                      "7.038531e-26", "1.4e-45", "3.4028235e38", "3.4028236e38",
+                      "123456789012345678901234567890", "0.000000000000000000000000000000000001",
+                      "000000.0000012345e4", "-0", "0e999", "1e-400", "1e400", "-1e400",
+                      "1234.5678", "-98765.4321e-3", "+.5", "5.", "2.5E+10"
+                   };
+
+      static const std::size_t hard_list_size = sizeof(hard_list) / sizeof(char*);
+
+      for (std::size_t i = 0; i < hard_list_size; ++i)
       {
-         v = 0.0;
-         if (!strtk::string_to_type_converter(double_str[i],v))
+         const std::string s = hard_list[i];
+
+         double      d = 0.0;
+         float       f = 0.0f;
+         long double l = 0.0L;
+
+         if (
+              !strtk::string_to_type_converter(s,d) ||
+              !strtk::string_to_type_converter(s,f) ||
+              !strtk::string_to_type_converter(s,l)
+            )
          {
-            std::cout << "test_double_convert() double convert[" << i << "]"
-                      << " dblstr: [" << double_str[i] << "]" << std::endl;
+            std::cout << "test_double_convert_rounding() - Failed to convert: " << s << std::endl;
             return false;
          }
 
-         if (not_equal(d[i],v) && (!strtk_isnan(v)))
+         if (!same_real(d,::strtod(hard_list[i],0)))
          {
-            std::cout << "test_double_convert() double check[" << i << "]"
-                      << " dblstr: [" << double_str[i] << "]" << std::endl;
+            std::cout << "test_double_convert_rounding() - Failed double rounding: " << s << std::endl;
+            return false;
+         }
+
+         if (!same_real(f,::strtof(hard_list[i],0)))
+         {
+            std::cout << "test_double_convert_rounding() - Failed float rounding: " << s << std::endl;
+            return false;
+         }
+
+         if (l != ::strtold(hard_list[i],0))
+         {
+            std::cout << "test_double_convert_rounding() - Failed long double rounding: " << s << std::endl;
             return false;
          }
       }
+   }
 
-      static const std::string bad_list[] =
-                          {
-                             "1234567.8A",      "1234567.A",      "12345A67.8",      "A1234567.8A",
-                            "1234567.8Ae", "1234567.AE+100", "12345A67.8e+100", "A1234567.8AE+100",
-                            "--1.234e+10",    "++1.234e+10",      "1.234e+10-",       "1.234e+10+",
-                             "1.234e++10",     "1.234E--10",         "1.e++10",          "1.E--10",
-                             "1..234e+10",     "1.23.4E-10",      "1.234e-1.0",            "1.23x",
-                             "1.23e+100y",               "",            "123+",             "123-",
-                                  "123.+",          "123.-",           "123+.",            "123-.",
-                               "123..123",       "123.-123",        "123.+123",           "123-.0",
-                                                             "+", "-", "+.", "-.", ".+", ".-", ".",
-                                                      "++", "--", "++.", "--.", ".++", ".--", "..",
-                                                      "+f", "-f", "+.f", "-.f", ".+f", ".-f", ".f",
-                                                      "+l", "-l", "+.l", "-.l", ".+l", ".-l", ".l",
-                              ".+0", ".+1", ".+2", ".+3", ".+4", ".+5", ".+6", ".+7", ".+8", ".+9",
-                              ".-0", ".-1", ".-2", ".-3", ".-4", ".-5", ".-6", ".-7", ".-8", ".-9",
-                    "..+0", "..+1", "..+2", "..+3", "..+4", "..+5", "..+6", "..+7", "..+8", "..+9",
-                    "..-0", "..-1", "..-2", "..-3", "..-4", "..-5", "..-6", "..-7", "..-8", "..-9",
-                    ".+0f", ".+1F", ".+2f", ".+3F", ".+4f", ".+5F", ".+6f", ".+7F", ".+8f", ".+9F",
-                    ".-0l", ".-1L", ".-2l", ".-3L", ".-4l", ".-5L", ".-6l", ".-7L", ".-8l", ".-9L"
-                          };
+   {
+      // Shortest and 17 digit representations of arbitrary doubles must round-trip.
+      unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+      for (std::size_t i = 0; i < 200000; ++i)
+      {
+         state ^= state << 13;
+         state ^= state >>  7;
+         state ^= state << 17;
+
+         double v = 0.0;
+         std::memcpy(&v,&state,sizeof(v));
+
+         if ((v != v) || ((v - v) != (v - v)))
+            continue;
+
+         char buffer[64];
+
+         for (int precision = 15; precision <= 17; ++precision)
+         {
+            sprintf(buffer,"%.*g",precision,v);
+
+            const std::string s = buffer;
+            double d = 0.0;
+
+            if (!strtk::string_to_type_converter(s.begin(),s.end(),d))
+            {
+               std::cout << "test_double_convert_rounding() - Failed to convert: " << s << std::endl;
+               return false;
+            }
+
+            if (!same_real(d,::strtod(buffer,0)))
+            {
+               std::cout << "test_double_convert_rounding() - Failed round-trip: " << s << std::endl;
+               return false;
+            }
+         }
+      }
+   }
+
+   {
+      static const std::string special_list[] = { "inf", "-INFINITY", "1.#INF", "-1.#INF", "nan", "NAN", "1.#NAN" };
+      static const std::size_t special_list_size = sizeof(special_list) / sizeof(std::string);
+
+      for (std::size_t i = 0; i < special_list_size; ++i)
+      {
+         double d = 0.0;
+
+         if (!strtk::string_to_type_converter(special_list[i],d) || ((d == d) && ((d - d) == (d - d))))
+         {
+            std::cout << "test_double_convert_rounding() - Failed special value: " << special_list[i] << std::endl;
+            return false;
+         }
+      }
+
+      static const std::string invalid_list[] = { "", "-", ".", "e5", "1e", "1.2.3", "1e5x", "12a" };
+      static const std::size_t invalid_list_size = sizeof(invalid_list) / sizeof(std::string);
+
+      for (std::size_t i = 0; i < invalid_list_size; ++i)
+      {
+         double d = 0.0;
+
+         if (strtk::string_to_type_converter(invalid_list[i],d))
+         {
+            std::cout << "test_double_convert_rounding() - Failed invalid value: " << invalid_list[i] << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+bool test_real_to_string()
+{
+   {
+      struct test_pair { double value; const char* expected; };
+
+      static const test_pair known_list[] =
+                   {
+                      { 0.0,    "0"     }, { -0.0, "-0" }, { 1.0, "1" }, { 0.1, "0.1" }, { 0.3, "0.3" },
+                      { 123456.789, "123456.789" }, { 1e16, "10000000000000000" }, { 1e17, "1e+17" },
+                      { 1e22,   "1e+22" }, { 1e23, "1e+23" }, { 0.0001, "0.0001" }, { 0.00001, "1e-05" },
+                      { -1.5e-7, "-1.5e-07" }, { 9007199254740992.0, "9007199254740992" },
+                      { 5e-324, "5e-324" }, { 1.7976931348623157e308, "1.7976931348623157e+308" }
+                   };
+
+      static const std::size_t known_list_size = sizeof(known_list) / sizeof(test_pair);
+
+      for (std::size_t i = 0; i < known_list_size; ++i)
+      {
+         if (strtk::type_to_string(known_list[i].value) != known_list[i].expected)
+         {
+            std::cout << "test_real_to_string() - Failed shortest: " << known_list[i].expected << std::endl;
+            return false;
+         }
+      }
+
+      if (
+           (strtk::type_to_string(0.1f) != "0.1") ||
+           (strtk::type_to_string(3.4028235e38f) != "3.4028235e+38") ||
+           (strtk::type_to_string(1e-45f) != "1e-45")
+         )
+      {
+         std::cout << "test_real_to_string() - Failed float shortest" << std::endl;
+         return false;
+      }
+   }
+
+   {
+      // Shortest output must round-trip and be no longer than the shortest %.Ne that does.
+      unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+      for (std::size_t i = 0; i < 200000; ++i)
+      {
+         state ^= state << 13;
+         state ^= state >>  7;
+         state ^= state << 17;
+
+         double v = 0.0;
+         std::memcpy(&v,&state,sizeof(v));
+
+         if (v != v)
+            continue;
+         else if (0 == (i & 1))
+            v = static_cast<double>(static_cast<long long>(state >> (state & 63))) / static_cast<double>(1ULL << (i & 31));
+
+         char buffer[strtk::max_real_string_size + 1];
+         buffer[strtk::real_to_string(v,buffer)] = 0;
+
+         if (!same_real(v,::strtod(buffer,0)))
+         {
+            std::cout << "test_real_to_string() - Failed round-trip: " << buffer << std::endl;
+            return false;
+         }
+
+         const float f = static_cast<float>(v);
+         char float_buffer[strtk::max_real_string_size + 1];
+         float_buffer[strtk::real_to_string(f,float_buffer)] = 0;
+
+         if (!same_real(f,::strtof(float_buffer,0)))
+         {
+            std::cout << "test_real_to_string() - Failed float round-trip: " << float_buffer << std::endl;
+            return false;
+         }
+
+         if ((v - v) != (v - v))
+            continue;
+
+         int digits = 0;
+         std::size_t length = std::strcspn(buffer,"e");
+
+         while ((length > 0) && (('0' == buffer[length - 1]) || ('.' == buffer[length - 1])))
+         {
+            --length;
+         }
+
+         for (std::size_t j = 0; j < length; ++j)
+         {
+            if (('0' <= buffer[j]) && (buffer[j] <= '9') && (digits || ('0' != buffer[j])))
+               ++digits;
+         }
+
+         char printf_buffer[64];
+
+         for (int precision = 1; precision < digits; ++precision)
+         {
+            sprintf(printf_buffer,"%.*e",precision - 1,v);
+
+            if (same_real(v,::strtod(printf_buffer,0)))
+            {
+               std::cout << "test_real_to_string() - Failed shortest: " << buffer << " vs " << printf_buffer << std::endl;
+               return false;
+            }
+         }
+
+         // Fixed mode must match printf's correctly rounded %.Nf
+         const std::size_t precision = i % 20;
+         std::string s;
+         strtk::real_to_string(v,precision,s);
+         sprintf(buffer,"%.*f",static_cast<int>(precision),v);
+
+         if (s != buffer)
+         {
+            std::cout << "test_real_to_string() - Failed fixed: " << s << " vs " << buffer << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      static const double value_list[] = { 0.5, 1.5, 2.5, -0.5, 0.125, 0.375, 1e-30, 2.1, 1e300 };
+      static const std::size_t value_list_size = sizeof(value_list) / sizeof(double);
+
+      for (std::size_t i = 0; i < value_list_size; ++i)
+      {
+         for (int precision = 0; precision <= 19; ++precision)
+         {
+            std::string s;
+            strtk::real_to_string(value_list[i],precision,s);
+
+            char buffer[strtk::max_real_string_size + 1];
+            sprintf(buffer,"%.*f",precision,value_list[i]);
+
+            if (s != buffer)
+            {
+               std::cout << "test_real_to_string() - Failed fixed: " << s << " vs " << buffer << std::endl;
+               return false;
+            }
+         }
+      }
+   }
+
+   {
+      std::vector<double> value_list;
+      value_list.push_back(1.25);
+      value_list.push_back(-0.1);
+      value_list.push_back(1e100);
+
+      if (strtk::join(",",value_list) != "1.25,-0.1,1e+100")
+      {
+         std::cout << "test_real_to_string() - Failed join" << std::endl;
+         return false;
+      }
+
+      std::ostringstream stream;
+      strtk::write_to_text_file(stream,value_list,"|");
+
+      if (stream.str() != "1.25|-0.1|1e+100|")
+      {
+         std::cout << "test_real_to_string() - Failed write_to_text_file" << std::endl;
+         return false;
+      }
+
+      // A stream that has been configured formats the values itself.
+      std::ostringstream fixed_stream;
+      fixed_stream << std::fixed << std::setprecision(2);
+      strtk::write_to_text_file(fixed_stream,value_list,"|");
+
+      std::ostringstream expected_stream;
+      expected_stream << std::fixed << std::setprecision(2) << 1.25 << "|" << -0.1 << "|" << 1e100 << "|";
+
+      if (fixed_stream.str() != expected_stream.str())
+      {
+         std::cout << "test_real_to_string() - Failed write_to_text_file with stream flags" << std::endl;
+         return false;
+      }
+
+      std::string s = "x";
+      char buffer[strtk::max_real_string_size];
+
+      if (
+           (0 != strtk::real_to_string(1.25,strtk::max_real_precision + 1,buffer)) ||
+           strtk::real_to_string(1.25,strtk::max_real_precision + 1,s) || !s.empty()
+         )
+      {
+         std::cout << "test_real_to_string() - Failed precision limit" << std::endl;
+         return false;
+      }
+
+      double inf = std::numeric_limits<double>::infinity();
+
+      if ((strtk::type_to_string(inf) != "inf") || (strtk::type_to_string(-inf) != "-inf"))
+      {
+         std::cout << "test_real_to_string() - Failed infinity" << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+template <typename T>
+bool test_batch_convert_matches_converter(const std::vector<std::pair<const char*,const char*> >& range_list)
+{
+   const std::size_t count = range_list.size();
+   std::vector<T> value_list(count);
+   std::vector<unsigned char> validity((count + 7) / 8);
+
+   strtk::batch_convert(&range_list[0],count,&value_list[0],&validity[0]);
+
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      T expected = T();
+      const bool is_valid = strtk::string_to_type_converter(range_list[i].first,range_list[i].second,expected);
+
+      if ((is_valid != (0 != (validity[i >> 3] & (1 << (i & 7))))) || (is_valid && (expected != value_list[i])))
+      {
+         std::cout << "test_batch_convert() - Failed digits fast path: "
+                   << std::string(range_list[i].first,range_list[i].second) << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_batch_convert()
+{
+   {
+      static const std::string data = "0|-0|+12|007|-|+||12a|a12|1 2|-+1|99|9999|32767|32768|-32768|-32769|65535|65536|"
+                                      "999999999|2147483647|2147483648|-2147483648|4294967295|4294967296|"
+                                      "123456789012345678|9223372036854775807|9223372036854775808|-9223372036854775808|"
+                                      "18446744073709551615|18446744073709551616|0000000000000000000000001|-00000000042|"
+                                      "12345678|123456789|1234567890123456|12345678901234567|/|:|9/|0:";
 
-      static const std::size_t bad_list_size = sizeof(bad_list) / sizeof(std::string);
+      std::vector<std::pair<const char*,const char*> > range_list;
+      strtk::split("|",data,std::back_inserter(range_list));
 
-      for (std::size_t i = 0; i < bad_list_size; ++i)
-      {
-         if (strtk::string_to_type_converter(bad_list[i],v))
-         {
-            std::cout << "test_double_convert() bad test failure [" << i << "]  - [" << bad_list[i] << "]" << std::endl;
-            return false;
-         }
-      }
+      bool result = true;
+
+      result &= test_batch_convert_matches_converter<short>             (range_list);
+      result &= test_batch_convert_matches_converter<unsigned short>    (range_list);
+      result &= test_batch_convert_matches_converter<int>               (range_list);
+      result &= test_batch_convert_matches_converter<unsigned int>      (range_list);
+      result &= test_batch_convert_matches_converter<long long>         (range_list);
+      result &= test_batch_convert_matches_converter<unsigned long long>(range_list);
+
+      if (!result)
+         return false;
    }
 
    {
-      static const std::size_t count = 10000000;
-      std::string s;
-      s.reserve(32);
-      double t = 0.0;
+      static const std::string data = "1,-2,x,4,,2147483647,2147483648,+8,9a,10";
 
-      for (int i = -static_cast<int>(count); i < static_cast<int>(count); ++i)
+      std::vector<std::pair<const char*,const char*> > range_list;
+      strtk::split(",",data,std::back_inserter(range_list));
+
+      const std::size_t count = range_list.size();
+      std::vector<int> value_list(count,-1);
+      std::vector<unsigned char> validity((count + 7) / 8,0xFF);
+
+      static const bool valid[]    = { true, true, false, true, false, true, false, true, false, true };
+      static const int  expected[] = { 1, -2, 0, 4, 0, 2147483647, 0, 8, 0, 10 };
+
+      if (6 != strtk::batch_convert(&range_list[0],count,&value_list[0],&validity[0]))
       {
-         if (!strtk::type_to_string(i,s))
-         {
-            std::cout << "test_double_convert() - Failed int to string @ " << i << std::endl;
-            return false;
-         }
+         std::cout << "test_batch_convert() - Failed int valid count" << std::endl;
+         return false;
+      }
 
-         if (!strtk::string_to_type_converter(s,t))
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         if (
+              (valid[i] != (0 != (validity[i >> 3] & (1 << (i & 7))))) ||
+              (expected[i] != value_list[i])
+            )
          {
-            std::cout << "test_double_convert() - Failed string to double @ " << i << std::endl;
+            std::cout << "test_batch_convert() - Failed int token: " << i << std::endl;
             return false;
          }
+      }
 
-         if (static_cast<double>(i) != t)
-         {
-            std::cout << "test_double_convert() - Failed i == t @ " << i << std::endl;
-            return false;
-         }
+      if (0x02 != validity[1])
+      {
+         std::cout << "test_batch_convert() - Failed int trailing validity bits" << std::endl;
+         return false;
+      }
 
-         s.clear();
+      std::vector<unsigned short> ushort_list(count);
+
+      if (4 != strtk::batch_convert(&range_list[0],count,&ushort_list[0],&validity[0]))
+      {
+         std::cout << "test_batch_convert() - Failed unsigned short valid count" << std::endl;
+         return false;
+      }
+
+      if ((0x89 != validity[0]) || (0x02 != validity[1]))
+      {
+         std::cout << "test_batch_convert() - Failed unsigned short validity" << std::endl;
+         return false;
       }
    }
 
    {
-      std::string s;
-      s.reserve(256);
+      std::string data;
+      std::vector<std::size_t> begin_offset;
+      std::vector<std::size_t> end_offset;
 
-      double v = -111111.11;
-      double t = 0.0;
+      for (std::size_t i = 0; i < 1000; ++i)
+      {
+         begin_offset.push_back(data.size());
+         data += (0 == (i % 7)) ? std::string("bad") : strtk::type_to_string(static_cast<long long>(i * i) * -12345678LL);
+         end_offset.push_back(data.size());
+         data += '|';
+      }
 
-      while (v < +111111.11)
+      const std::size_t count = begin_offset.size();
+      std::vector<long long> value_list(count);
+      std::vector<unsigned char> validity((count + 7) / 8);
+
+      const std::size_t valid_count = strtk::batch_convert(data.data(),
+                                                           &begin_offset[0],&end_offset[0],
+                                                           count,
+                                                           &value_list[0],&validity[0]);
+
+      if (count - ((count + 6) / 7) != valid_count)
       {
-         std_double_to_string(v,s);
-         if (!strtk::string_to_type_converter(s,t))
-         {
-            std::cout << "test_double_convert() - Failed decimal to string,  t: " << t << std::endl;
-            return false;
-         }
+         std::cout << "test_batch_convert() - Failed long long valid count" << std::endl;
+         return false;
+      }
 
-         if (not_equal(t,v,0.0000000001))
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         const bool is_valid = (0 != (validity[i >> 3] & (1 << (i & 7))));
+         const long long expected = (0 == (i % 7)) ? 0 : static_cast<long long>(i * i) * -12345678LL;
+
+         if (((0 != (i % 7)) != is_valid) || (expected != value_list[i]))
          {
-            std::cout << "test_double_convert() - Failed decimal r == t  r: " << t << std::endl;
+            std::cout << "test_batch_convert() - Failed long long token: " << i << std::endl;
             return false;
          }
-
-         v += 0.01;
-         s.clear();
-         t = 0.0;
       }
    }
 
    {
-      double d1 = +123.456;
-      double d2 = -123.456;
-      double delta[] =
-             {
-               0.333,   0.555,   0.777,
-               0.999, 0.13579, 0.97531
-             };
-      std::size_t delta_size = sizeof(delta) / sizeof(double);
+      static const std::string data = "1.5 -2e3 abc 0.1 inf 1..5";
 
-      std::string s;
-      s.reserve(256);
-      double tmp = 0.0;
+      std::vector<std::pair<const char*,const char*> > range_list;
+      strtk::split(" ",data,std::back_inserter(range_list));
 
-      for (int i = 0; i < 1000000; ++i)
+      std::vector<double> value_list(range_list.size());
+      unsigned char validity = 0;
+
+      const std::size_t valid_count = strtk::batch_convert(&range_list[0],range_list.size(),&value_list[0],&validity);
+
+      if (
+           (4 != valid_count)         ||
+           (0x1B != validity)         ||
+           (1.5    != value_list[0])  ||
+           (-2e3   != value_list[1])  ||
+           (0.0    != value_list[2])  ||
+           (0.1    != value_list[3])  ||
+           (0.0    != value_list[5])
+         )
       {
-         std_double_to_string(d1,s);
+         std::cout << "test_batch_convert() - Failed double" << std::endl;
+         return false;
+      }
+   }
 
-         if (!strtk::string_to_type_converter(s,tmp))
-         {
-            std::cout << "test_double_convert() - (1) final test string to double failure @ " << i << std::endl;
-            return false;
-         }
+   return true;
+}
 
-         if (not_equal(d1,tmp,0.000000001))
-         {
-            std::cout << "test_double_convert() - (1) final test compare failure @ " << i << std::endl;
-            return false;
-         }
+template <typename T>
+inline std::string to_chars(const T& t)
+{
+   char buffer[strtk::max_numeric_string_size];
+   const std::size_t length = strtk::type_to_string(t,buffer);
+   return std::string(buffer,length);
+}
 
-         d1 += delta[std::abs(i) % delta_size];
+bool test_type_to_string_buffer()
+{
+   {
+      if (
+           (to_chars(0)                                              != "0"                   ) ||
+           (to_chars(-123)                                           != "-123"                ) ||
+           (to_chars(std::numeric_limits<int>::min())                != "-2147483648"         ) ||
+           (to_chars(std::numeric_limits<long long>::min())          != "-9223372036854775808") ||
+           (to_chars(std::numeric_limits<unsigned long long>::max()) != "18446744073709551615") ||
+           (to_chars(static_cast<unsigned short>(65535))             != "65535"               ) ||
+           (to_chars(-0.25)                                          != "-0.25"               ) ||
+           (to_chars(0.5f)                                           != "0.5"                 ) ||
+           (to_chars('z')                                            != "z"                   ) ||
+           (to_chars(true)                                           != "1"                   )
+         )
+      {
+         std::cout << "test_type_to_string_buffer() - Failed char buffer" << std::endl;
+         return false;
+      }
+   }
 
-         std_double_to_string(d2,s);
+   {
+      unsigned long long state = 0x2545F4914F6CDD1DULL;
 
-         if (!strtk::string_to_type_converter(s,tmp))
-         {
-            std::cout << "test_double_convert() - (2) final test string to double failure @ " << i << std::endl;
-            return false;
-         }
+      for (std::size_t i = 0; i < 100000; ++i)
+      {
+         state ^= state << 13; state ^= state >> 7; state ^= state << 17;
 
-         if (not_equal(d2,tmp,0.000000001))
+         const long long v = static_cast<long long>(state) >> (i % 64);
+         std::string s("prefix:");
+
+         if (
+              !strtk::type_to_string_append(v,s) ||
+              (s != ("prefix:" + strtk::type_to_string(v)))
+            )
          {
-            std::cout << "test_double_convert() - (2) final test compare failure @ " << i << std::endl;
+            std::cout << "test_type_to_string_buffer() - Failed append: " << v << std::endl;
             return false;
          }
-
-         d2 -= delta[std::abs(i) % delta_size];
       }
    }
 
    {
-      static const std::string dbl_str_list[] =
-                                  {
-                                     "0.0",
-                                     "1.0E+001", "1.0E+002", "1.0E+003", "1.0E+004", "1.0E+005", "1.0E+006", "1.0E+007", "1.0E+008", "1.0E+009", "1.0E+010",
-                                     "1.0E+011", "1.0E+012", "1.0E+013", "1.0E+014", "1.0E+015", "1.0E+016", "1.0E+017", "1.0E+018", "1.0E+019", "1.0E+020",
-                                     "1.0E+021", "1.0E+022", "1.0E+023", "1.0E+024", "1.0E+025", "1.0E+026", "1.0E+027", "1.0E+028", "1.0E+029", "1.0E+030",
-                                     "1.0E+031", "1.0E+032", "1.0E+033", "1.0E+034", "1.0E+035", "1.0E+036", "1.0E+037", "1.0E+038", "1.0E+039", "1.0E+040",
-                                     "1.0E+041", "1.0E+042", "1.0E+043", "1.0E+044", "1.0E+045", "1.0E+046", "1.0E+047", "1.0E+048", "1.0E+049", "1.0E+050",
-                                     "1.0E+051", "1.0E+052", "1.0E+053", "1.0E+054", "1.0E+055", "1.0E+056", "1.0E+057", "1.0E+058", "1.0E+059", "1.0E+060",
-                                     "1.0E+061", "1.0E+062", "1.0E+063", "1.0E+064", "1.0E+065", "1.0E+066", "1.0E+067", "1.0E+068", "1.0E+069", "1.0E+070",
-                                     "1.0E+071", "1.0E+072", "1.0E+073", "1.0E+074", "1.0E+075", "1.0E+076", "1.0E+077", "1.0E+078", "1.0E+079", "1.0E+080",
-                                     "1.0E+081", "1.0E+082", "1.0E+083", "1.0E+084", "1.0E+085", "1.0E+086", "1.0E+087", "1.0E+088", "1.0E+089", "1.0E+090",
-                                     "1.0E+091", "1.0E+092", "1.0E+093", "1.0E+094", "1.0E+095", "1.0E+096", "1.0E+097", "1.0E+098", "1.0E+099", "1.0E+100",
-                                     "1.0E+101", "1.0E+102", "1.0E+103", "1.0E+104", "1.0E+105", "1.0E+106", "1.0E+107", "1.0E+108", "1.0E+109", "1.0E+110",
-                                     "1.0E+111", "1.0E+112", "1.0E+113", "1.0E+114", "1.0E+115", "1.0E+116", "1.0E+117", "1.0E+118", "1.0E+119", "1.0E+120",
-                                     "1.0E+121", "1.0E+122", "1.0E+123", "1.0E+124", "1.0E+125", "1.0E+126", "1.0E+127", "1.0E+128", "1.0E+129", "1.0E+130",
-                                     "1.0E+131", "1.0E+132", "1.0E+133", "1.0E+134", "1.0E+135", "1.0E+136", "1.0E+137", "1.0E+138", "1.0E+139", "1.0E+140",
-                                     "1.0E+141", "1.0E+142", "1.0E+143", "1.0E+144", "1.0E+145", "1.0E+146", "1.0E+147", "1.0E+148", "1.0E+149", "1.0E+150",
-                                     "1.0E+151", "1.0E+152", "1.0E+153", "1.0E+154", "1.0E+155", "1.0E+156", "1.0E+157", "1.0E+158", "1.0E+159", "1.0E+160",
-                                     "1.0E+161", "1.0E+162", "1.0E+163", "1.0E+164", "1.0E+165", "1.0E+166", "1.0E+167", "1.0E+168", "1.0E+169", "1.0E+170",
-                                     "1.0E+171", "1.0E+172", "1.0E+173", "1.0E+174", "1.0E+175", "1.0E+176", "1.0E+177", "1.0E+178", "1.0E+179", "1.0E+180",
-                                     "1.0E+181", "1.0E+182", "1.0E+183", "1.0E+184", "1.0E+185", "1.0E+186", "1.0E+187", "1.0E+188", "1.0E+189", "1.0E+190",
-                                     "1.0E+191", "1.0E+192", "1.0E+193", "1.0E+194", "1.0E+195", "1.0E+196", "1.0E+197", "1.0E+198", "1.0E+199", "1.0E+200",
-                                     "1.0E+201", "1.0E+202", "1.0E+203", "1.0E+204", "1.0E+205", "1.0E+206", "1.0E+207", "1.0E+208", "1.0E+209", "1.0E+210",
-                                     "1.0E+211", "1.0E+212", "1.0E+213", "1.0E+214", "1.0E+215", "1.0E+216", "1.0E+217", "1.0E+218", "1.0E+219", "1.0E+220",
-                                     "1.0E+221", "1.0E+222", "1.0E+223", "1.0E+224", "1.0E+225", "1.0E+226", "1.0E+227", "1.0E+228", "1.0E+229", "1.0E+230",
-                                     "1.0E+231", "1.0E+232", "1.0E+233", "1.0E+234", "1.0E+235", "1.0E+236", "1.0E+237", "1.0E+238", "1.0E+239", "1.0E+240",
-                                     "1.0E+241", "1.0E+242", "1.0E+243", "1.0E+244", "1.0E+245", "1.0E+246", "1.0E+247", "1.0E+248", "1.0E+249", "1.0E+250",
-                                     "1.0E+251", "1.0E+252", "1.0E+253", "1.0E+254", "1.0E+255", "1.0E+256", "1.0E+257", "1.0E+258", "1.0E+259", "1.0E+260",
-                                     "1.0E+261", "1.0E+262", "1.0E+263", "1.0E+264", "1.0E+265", "1.0E+266", "1.0E+267", "1.0E+268", "1.0E+269", "1.0E+270",
-                                     "1.0E+271", "1.0E+272", "1.0E+273", "1.0E+274", "1.0E+275", "1.0E+276", "1.0E+277", "1.0E+278", "1.0E+279", "1.0E+280",
-                                     "1.0E+281", "1.0E+282", "1.0E+283", "1.0E+284", "1.0E+285", "1.0E+286", "1.0E+287", "1.0E+288", "1.0E+289", "1.0E+290",
-                                     "1.0E+291", "1.0E+292", "1.0E+293", "1.0E+294", "1.0E+295", "1.0E+296", "1.0E+297", "1.0E+298", "1.0E+299", "1.0E+300",
-                                     "1.0E+301", "1.0E+302", "1.0E+303", "1.0E+304", "1.0E+305", "1.0E+306", "1.0E+307", "1.0E+308"
-                                  };
-      static const std::size_t dbl_str_list_size = sizeof(dbl_str_list) / sizeof(std::string);
+      std::string s;
 
-      static const double dbl_list[] =
-                                  {
-                                     0.0,
-                                     1.0E+001, 1.0E+002, 1.0E+003, 1.0E+004, 1.0E+005, 1.0E+006, 1.0E+007, 1.0E+008, 1.0E+009, 1.0E+010,
-                                     1.0E+011, 1.0E+012, 1.0E+013, 1.0E+014, 1.0E+015, 1.0E+016, 1.0E+017, 1.0E+018, 1.0E+019, 1.0E+020,
-                                     1.0E+021, 1.0E+022, 1.0E+023, 1.0E+024, 1.0E+025, 1.0E+026, 1.0E+027, 1.0E+028, 1.0E+029, 1.0E+030,
-                                     1.0E+031, 1.0E+032, 1.0E+033, 1.0E+034, 1.0E+035, 1.0E+036, 1.0E+037, 1.0E+038, 1.0E+039, 1.0E+040,
-                                     1.0E+041, 1.0E+042, 1.0E+043, 1.0E+044, 1.0E+045, 1.0E+046, 1.0E+047, 1.0E+048, 1.0E+049, 1.0E+050,
-                                     1.0E+051, 1.0E+052, 1.0E+053, 1.0E+054, 1.0E+055, 1.0E+056, 1.0E+057, 1.0E+058, 1.0E+059, 1.0E+060,
-                                     1.0E+061, 1.0E+062, 1.0E+063, 1.0E+064, 1.0E+065, 1.0E+066, 1.0E+067, 1.0E+068, 1.0E+069, 1.0E+070,
-                                     1.0E+071, 1.0E+072, 1.0E+073, 1.0E+074, 1.0E+075, 1.0E+076, 1.0E+077, 1.0E+078, 1.0E+079, 1.0E+080,
-                                     1.0E+081, 1.0E+082, 1.0E+083, 1.0E+084, 1.0E+085, 1.0E+086, 1.0E+087, 1.0E+088, 1.0E+089, 1.0E+090,
-                                     1.0E+091, 1.0E+092, 1.0E+093, 1.0E+094, 1.0E+095, 1.0E+096, 1.0E+097, 1.0E+098, 1.0E+099, 1.0E+100,
-                                     1.0E+101, 1.0E+102, 1.0E+103, 1.0E+104, 1.0E+105, 1.0E+106, 1.0E+107, 1.0E+108, 1.0E+109, 1.0E+110,
-                                     1.0E+111, 1.0E+112, 1.0E+113, 1.0E+114, 1.0E+115, 1.0E+116, 1.0E+117, 1.0E+118, 1.0E+119, 1.0E+120,
-                                     1.0E+121, 1.0E+122, 1.0E+123, 1.0E+124, 1.0E+125, 1.0E+126, 1.0E+127, 1.0E+128, 1.0E+129, 1.0E+130,
-                                     1.0E+131, 1.0E+132, 1.0E+133, 1.0E+134, 1.0E+135, 1.0E+136, 1.0E+137, 1.0E+138, 1.0E+139, 1.0E+140,
-                                     1.0E+141, 1.0E+142, 1.0E+143, 1.0E+144, 1.0E+145, 1.0E+146, 1.0E+147, 1.0E+148, 1.0E+149, 1.0E+150,
-                                     1.0E+151, 1.0E+152, 1.0E+153, 1.0E+154, 1.0E+155, 1.0E+156, 1.0E+157, 1.0E+158, 1.0E+159, 1.0E+160,
-                                     1.0E+161, 1.0E+162, 1.0E+163, 1.0E+164, 1.0E+165, 1.0E+166, 1.0E+167, 1.0E+168, 1.0E+169, 1.0E+170,
-                                     1.0E+171, 1.0E+172, 1.0E+173, 1.0E+174, 1.0E+175, 1.0E+176, 1.0E+177, 1.0E+178, 1.0E+179, 1.0E+180,
-                                     1.0E+181, 1.0E+182, 1.0E+183, 1.0E+184, 1.0E+185, 1.0E+186, 1.0E+187, 1.0E+188, 1.0E+189, 1.0E+190,
-                                     1.0E+191, 1.0E+192, 1.0E+193, 1.0E+194, 1.0E+195, 1.0E+196, 1.0E+197, 1.0E+198, 1.0E+199, 1.0E+200,
-                                     1.0E+201, 1.0E+202, 1.0E+203, 1.0E+204, 1.0E+205, 1.0E+206, 1.0E+207, 1.0E+208, 1.0E+209, 1.0E+210,
-                                     1.0E+211, 1.0E+212, 1.0E+213, 1.0E+214, 1.0E+215, 1.0E+216, 1.0E+217, 1.0E+218, 1.0E+219, 1.0E+220,
-                                     1.0E+221, 1.0E+222, 1.0E+223, 1.0E+224, 1.0E+225, 1.0E+226, 1.0E+227, 1.0E+228, 1.0E+229, 1.0E+230,
-                                     1.0E+231, 1.0E+232, 1.0E+233, 1.0E+234, 1.0E+235, 1.0E+236, 1.0E+237, 1.0E+238, 1.0E+239, 1.0E+240,
-                                     1.0E+241, 1.0E+242, 1.0E+243, 1.0E+244, 1.0E+245, 1.0E+246, 1.0E+247, 1.0E+248, 1.0E+249, 1.0E+250,
-                                     1.0E+251, 1.0E+252, 1.0E+253, 1.0E+254, 1.0E+255, 1.0E+256, 1.0E+257, 1.0E+258, 1.0E+259, 1.0E+260,
-                                     1.0E+261, 1.0E+262, 1.0E+263, 1.0E+264, 1.0E+265, 1.0E+266, 1.0E+267, 1.0E+268, 1.0E+269, 1.0E+270,
-                                     1.0E+271, 1.0E+272, 1.0E+273, 1.0E+274, 1.0E+275, 1.0E+276, 1.0E+277, 1.0E+278, 1.0E+279, 1.0E+280,
-                                     1.0E+281, 1.0E+282, 1.0E+283, 1.0E+284, 1.0E+285, 1.0E+286, 1.0E+287, 1.0E+288, 1.0E+289, 1.0E+290,
-                                     1.0E+291, 1.0E+292, 1.0E+293, 1.0E+294, 1.0E+295, 1.0E+296, 1.0E+297, 1.0E+298, 1.0E+299, 1.0E+300,
-                                     1.0E+301, 1.0E+302, 1.0E+303, 1.0E+304, 1.0E+305, 1.0E+306, 1.0E+307, 1.0E+308
-                                  };
+      strtk::type_to_string_append(12u,s);
+      strtk::type_to_string_append(std::string("|ab|"),s);
+      strtk::type_to_string_append(3.5,s);
+      strtk::type_to_string_append('|',s);
+      strtk::type_to_string_append(false,s);
 
-      for (std::size_t i = 0; i < dbl_str_list_size; ++i)
+      std::vector<char> v;
+      strtk::type_to_string_copy(-7,std::back_inserter(v));
+      strtk::type_to_string_copy(std::string("xy"),std::back_inserter(v));
+
+      if (("12|ab|3.5|0" != s) || ("-7xy" != std::string(v.begin(),v.end())))
       {
-         double d = std::numeric_limits<double>::quiet_NaN();
+         std::cout << "test_type_to_string_buffer() - Failed append/copy" << std::endl;
+         return false;
+      }
 
-         if (!strtk::string_to_type_converter(dbl_str_list[i],d))
-         {
-            std::cout << "test_double_convert() - Failed frac-table string to double: " << dbl_str_list[i] << std::endl;
-            return false;
-         }
+      std::vector<int> int_list;
+      int_list.push_back(1); int_list.push_back(-22); int_list.push_back(333);
 
-         if (not_equal(dbl_list[i],d,0.0000000001))
-         {
-            std::cout << "test_double_convert() - Failed frac-table i == d: " << dbl_str_list[i] << std::endl;
-            return false;
-         }
+      std::string joined("[");
+      strtk::join(joined,",",int_list);
+
+      if (("[1,-22,333" != joined) || ("x=5,y=-0.5" != std::string(strtk::build_string() << "x=" << 5 << ",y=" << -0.5)))
+      {
+         std::cout << "test_type_to_string_buffer() - Failed join/build_string" << std::endl;
+         return false;
       }
    }
 
@@ -1874,6 +4281,63 @@ bool test_int_uint_convert()
       }
    }
 
+
+   {
+      // Every length and every position of a bad digit, across the eight digit block boundaries.
+      unsigned long long state = 0x2545F4914F6CDD1DULL;
+
+      for (std::size_t length = 1; length <= 19; ++length)
+      {
+         for (std::size_t i = 0; i < 200; ++i)
+         {
+            std::string s;
+            unsigned long long expected = 0;
+
+            for (std::size_t j = 0; j < length; ++j)
+            {
+               state ^= state << 13;
+               state ^= state >>  7;
+               state ^= state << 17;
+
+               const char digit = static_cast<char>('0' + (state >> 32) % 10);
+               s += digit;
+               expected = expected * 10 + static_cast<unsigned long long>(digit - '0');
+            }
+
+            unsigned long long u = 0;
+            long long          v = 0;
+            unsigned long long f = 0;
+
+            const bool in_signed_range = (expected <= 9223372036854775807ULL);
+
+            if (
+                 !strtk::string_to_type_converter(s,u) ||
+                 !strtk::fast::numeric_convert(s,f,true) ||
+                 (u != expected) ||
+                 (f != expected) ||
+                 (in_signed_range != strtk::string_to_type_converter("-" + s,v)) ||
+                 (in_signed_range && (v != -static_cast<long long>(expected)))
+               )
+            {
+               std::cout << "test_int_uint_convert() - Failed digit block convert: " << s << std::endl;
+               return false;
+            }
+
+            std::string bad = s;
+            bad[(state >> 40) % length] = ((state >> 20) & 1) ? '/' : ':';
+
+            if (
+                 strtk::string_to_type_converter(bad,u) ||
+                 strtk::string_to_type_converter(bad,v) ||
+                 strtk::fast::all_digits_check(bad)
+               )
+            {
+               std::cout << "test_int_uint_convert() - Failed digit block bad digit: " << bad << std::endl;
+               return false;
+            }
+         }
+      }
+   }
    return true;
 }
 
@@ -1896,6 +4360,30 @@ bool test_parse1()
       return false;
    }
 
+   i = 0;
+   d = 0;
+   s.clear();
+
+   if (!strtk::parse(data,strtk::static_delimiter_predicate<',','|','\t',' '>(),i,d,s))
+   {
+      std::cout << "test_parse() - parse fail 3" << std::endl;
+      return false;
+   }
+
+   if ((i != 1) || (d != 987.654) || (s != "abc"))
+   {
+      std::cout << "test_parse() - parse fail 4" << std::endl;
+      return false;
+   }
+
+   std::vector<int> int_list;
+
+   if (5 != strtk::parse("1,2|3,4|5",strtk::static_delimiter_predicate<',','|'>(),int_list))
+   {
+      std::cout << "test_parse() - parse fail 5" << std::endl;
+      return false;
+   }
+
    return true;
 }
 
@@ -2763,8 +5251,30 @@ int main()
    result &= test_split_options();
    result &= test_split_n();
    result &= test_empty_filter_itr();
+   result &= test_contiguous_split();
+   result &= test_split_parallel();
+   result &= test_compact_token_index();
+   result &= test_stream_tokenizer();
+   result &= test_dsv_quote_index();
+   result &= test_token_batch();
+   result &= test_field_index();
+   result &= test_token_grid_memory_map();
+   result &= test_token_grid_thread_count();
+   result &= test_token_grid_static_delimiters();
+   result &= test_token_grid_materialize();
+   result &= test_token_grid_index_file();
+   result &= test_token_grid_refresh();
+   result &= test_token_grid_delete();
+   result &= test_token_grid_group_by();
+   result &= test_token_grid_join();
+   result &= test_token_grid_partial_load();
+   result &= test_token_grid_memory_footprint();
    result &= test_construct_and_parse();
    result &= test_double_convert();
+   result &= test_double_convert_rounding();
+   result &= test_real_to_string();
+   result &= test_batch_convert();
+   result &= test_type_to_string_buffer();
    result &= test_fast_convert();
    result &= test_int_uint_convert();
    result &= test_parse1();